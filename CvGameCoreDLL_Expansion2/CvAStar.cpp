@@ -115,8 +115,12 @@ CvAStar::CvAStar()
 
 	m_pData = NULL;
 
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+	m_uiOpenSequence = 0;
+#else
 	m_pOpen = NULL;
 	m_pOpenTail = NULL;
+#endif
 	m_pClosed = NULL;
 	m_pBest = NULL;
 	m_pStackHead = NULL;
@@ -200,8 +204,15 @@ void CvAStar::Initialize(int iColumns, int iRows, bool bWrapX, bool bWrapY, CvAP
 	m_bWrapY = bWrapY;
 	m_bForceReset = false;
 
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+	m_apOpenHeap.clear();
+	// Two-layer pathfinders can have a partial move node open for every regular node
+	m_apOpenHeap.reserve(2 * m_iColumns * m_iRows);
+	m_uiOpenSequence = 0;
+#else
 	m_pOpen = NULL;
 	m_pOpenTail = NULL;
+#endif
 	m_pClosed = NULL;
 	m_pBest = NULL;
 	m_pStackHead = NULL;
@@ -297,6 +308,18 @@ bool CvAStar::GeneratePath(int iXstart, int iYstart, int iXdest, int iYdest, int
 			for (int iJ = 0; iJ < m_iRows; iJ++)
 				m_ppaaNodes[iI][iJ].clear();
 		m_pClosed = NULL;
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+		m_apOpenHeap.clear();
+		m_uiOpenSequence = 0;
+#endif
+#else
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+		for (std::vector<CvAStarNode*>::iterator it = m_apOpenHeap.begin(); it != m_apOpenHeap.end(); ++it)
+		{
+			(*it)->clear();
+		}
+		m_apOpenHeap.clear();
+		m_uiOpenSequence = 0;
 #else
 #ifndef AUI_ASTAR_MINOR_OPTIMIZATION
 		if(m_pOpen)
@@ -309,6 +332,7 @@ bool CvAStar::GeneratePath(int iXstart, int iYstart, int iXdest, int iYdest, int
 				m_pOpen = temp;
 			}
 		}
+#endif
 
 #ifndef AUI_ASTAR_MINOR_OPTIMIZATION
 		if(m_pClosed)
@@ -347,10 +371,16 @@ bool CvAStar::GeneratePath(int iXstart, int iYstart, int iXdest, int iYdest, int
 		}
 		temp->m_iTotalCost = temp->m_iKnownCost + temp->m_iHeuristicCost;
 
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+		PushOpenHeap(temp);
+
+		udFunc(udNotifyList, NULL, temp, ASNL_STARTOPEN, m_pData);
+#else
 		m_pOpen = temp;
 		m_pOpenTail = temp;
 
 		udFunc(udNotifyList, NULL, m_pOpen, ASNL_STARTOPEN, m_pData);
+#endif
 		udFunc(udValid, NULL, temp, 0, m_pData);
 		udFunc(udNotifyChild, NULL, temp, ASNC_INITIALADD, m_pData);
 	}
@@ -440,6 +470,23 @@ int CvAStar::Step()
 /// Returns best node
 CvAStarNode* CvAStar::GetBest()
 {
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+	if (m_apOpenHeap.empty())
+	{
+		return NULL;
+	}
+
+	CvAStarNode* temp = m_apOpenHeap.front();
+	CvAStarNode* pLast = m_apOpenHeap.back();
+	m_apOpenHeap.pop_back();
+	temp->m_iHeapIndex = -1;
+	if (pLast != temp)
+	{
+		m_apOpenHeap[0] = pLast;
+		pLast->m_iHeapIndex = 0;
+		OpenHeapSiftDown(0);
+	}
+#else
 #ifndef AUI_ASTAR_MINOR_OPTIMIZATION
 	CvAStarNode* temp;
 #endif
@@ -464,6 +511,7 @@ CvAStarNode* CvAStar::GetBest()
 	{
 		m_pOpenTail = NULL;
 	}
+#endif
 
 	udFunc(udNotifyList, NULL, temp, ASNL_DELETEOPEN, m_pData);
 
@@ -681,6 +729,15 @@ void CvAStar::LinkChild(CvAStarNode* node, CvAStarNode* check)
 /// Add node to open list
 void CvAStar::AddToOpen(CvAStarNode* addnode)
 {
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+	addnode->m_eCvAStarListType = CVASTARLIST_OPEN;
+
+	// The sorted list inserted a node behind every node of equal cost, so the sequence number preserves that ordering
+	PushOpenHeap(addnode);
+
+	udFunc(udNotifyList, NULL, addnode, ASNL_ADDOPEN, m_pData);
+}
+#else
 #ifndef AUI_ASTAR_MINOR_OPTIMIZATION
 	CvAStarNode* node;
 #endif
@@ -844,11 +901,20 @@ void CvAStar::AddToOpen(CvAStarNode* addnode)
 		udFunc(udNotifyList, prev, addnode, ASNL_ADDOPEN, m_pData);
 	}
 }
+#endif
 
 //	--------------------------------------------------------------------------------
 /// Connect in a node
 void CvAStar::UpdateOpenNode(CvAStarNode* node)
 {
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+	FAssert(node->m_eCvAStarListType == CVASTARLIST_OPEN);
+	FAssert(node->m_iHeapIndex >= 0 && node->m_iHeapIndex < (int)m_apOpenHeap.size() && m_apOpenHeap[node->m_iHeapIndex] == node);
+
+	// Costs only ever decrease here; the sorted list moved the node behind every node of equal cost, so it gets a fresh sequence number
+	node->m_uiOpenSequence = m_uiOpenSequence++;
+	OpenHeapSiftUp(node->m_iHeapIndex);
+#else
 #ifdef AUI_ASTAR_MINOR_OPTIMIZATION
 	CvAStarNode* temp = node->m_pPrev;
 #else
@@ -914,7 +980,66 @@ void CvAStar::UpdateOpenNode(CvAStarNode* node)
 			m_pOpen = node;
 		}
 	}
+#endif
+}
+
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+//	--------------------------------------------------------------------------------
+/// Add a node to the open list heap
+void CvAStar::PushOpenHeap(CvAStarNode* node)
+{
+	node->m_uiOpenSequence = m_uiOpenSequence++;
+	node->m_iHeapIndex = (int)m_apOpenHeap.size();
+	m_apOpenHeap.push_back(node);
+	OpenHeapSiftUp(node->m_iHeapIndex);
+}
+
+//	--------------------------------------------------------------------------------
+/// Move a node up the open list heap until its parent comes before it
+void CvAStar::OpenHeapSiftUp(uint uiIndex)
+{
+	CvAStarNode* node = m_apOpenHeap[uiIndex];
+	while (uiIndex > 0)
+	{
+		uint uiParent = (uiIndex - 1) >> 1;
+		CvAStarNode* pParent = m_apOpenHeap[uiParent];
+		if (!IsOpenHeapBefore(node, pParent))
+			break;
+
+		m_apOpenHeap[uiIndex] = pParent;
+		pParent->m_iHeapIndex = uiIndex;
+		uiIndex = uiParent;
+	}
+	m_apOpenHeap[uiIndex] = node;
+	node->m_iHeapIndex = uiIndex;
+}
+
+//	--------------------------------------------------------------------------------
+/// Move a node down the open list heap until both of its children come after it
+void CvAStar::OpenHeapSiftDown(uint uiIndex)
+{
+	const uint uiSize = m_apOpenHeap.size();
+	CvAStarNode* node = m_apOpenHeap[uiIndex];
+	for (;;)
+	{
+		uint uiChild = (uiIndex << 1) + 1;
+		if (uiChild >= uiSize)
+			break;
+
+		if (uiChild + 1 < uiSize && IsOpenHeapBefore(m_apOpenHeap[uiChild + 1], m_apOpenHeap[uiChild]))
+			uiChild++;
+		CvAStarNode* pChild = m_apOpenHeap[uiChild];
+		if (!IsOpenHeapBefore(pChild, node))
+			break;
+
+		m_apOpenHeap[uiIndex] = pChild;
+		pChild->m_iHeapIndex = uiIndex;
+		uiIndex = uiChild;
+	}
+	m_apOpenHeap[uiIndex] = node;
+	node->m_iHeapIndex = uiIndex;
 }
+#endif
 
 //	--------------------------------------------------------------------------------
 /// Refresh parent node (after linking in a child)
@@ -3116,6 +3241,45 @@ int StepCost(CvAStarNode* parent, CvAStarNode* node, int data, const void* point
 }
 
 
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+//	--------------------------------------------------------------------------------
+/// Step path finder - can ePlayer step onto this plot at all (everything StepValid() checks except the area)
+static bool IsStepPlotPassable(const CvPlot* pNewPlot, PlayerTypes ePlayer, PlayerTypes eEnemy)
+{
+#ifdef AUI_ASTAR_FIX_STEP_VALID_CONSIDERS_MOUNTAINS
+	if (pNewPlot->isImpassable())
+#else
+	if (pNewPlot->isImpassable() || pNewPlot->isMountain())
+#endif
+	{
+		return false;
+	}
+
+	CvPlayer& thisPlayer = GET_PLAYER(ePlayer);
+
+	// Ocean hex and team can't navigate on oceans?
+	if (!GET_TEAM(thisPlayer.getTeam()).getEmbarkedAllWaterPassage())
+	{
+		if (pNewPlot->getTerrainType() == TERRAIN_OCEAN)
+		{
+			return false;
+		}
+	}
+
+	PlayerTypes ePlotOwnerPlayer = pNewPlot->getOwner();
+	if (ePlotOwnerPlayer != NO_PLAYER && ePlotOwnerPlayer != eEnemy && !pNewPlot->IsFriendlyTerritory(ePlayer))
+	{
+		CvPlayer& plotOwnerPlayer = GET_PLAYER(ePlotOwnerPlayer);
+		if (!plotOwnerPlayer.isMinorCiv() && !atWar(thisPlayer.getTeam(), plotOwnerPlayer.getTeam()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#endif
 //	--------------------------------------------------------------------------------
 /// Step path finder - check validity of a coordinate
 int StepValid(CvAStarNode* parent, CvAStarNode* node, int data, const void* pointer, CvAStar* finder)
@@ -3130,7 +3294,9 @@ int StepValid(CvAStarNode* parent, CvAStarNode* node, int data, const void* poin
 
 	PlayerTypes eEnemy = *(PlayerTypes*)pointer;
 
+#ifndef AUI_ASTAR_STEP_PATH_COMPONENTS
 	CvPlayer& thisPlayer = GET_PLAYER(ePlayer);
+#endif
 
 #ifdef AUI_ASTAR_CACHE_PLOTS_AT_NODES
 	CvPlot* pNewPlot = node->m_pPlot;
@@ -3147,6 +3313,9 @@ int StepValid(CvAStarNode* parent, CvAStarNode* node, int data, const void* poin
 		return FALSE;
 	}
 
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	return (IsStepPlotPassable(pNewPlot, ePlayer, eEnemy) ? TRUE : FALSE);
+#else
 #ifdef AUI_ASTAR_FIX_STEP_VALID_CONSIDERS_MOUNTAINS
 	if (pNewPlot->isImpassable())
 #else
@@ -3184,6 +3353,7 @@ int StepValid(CvAStarNode* parent, CvAStarNode* node, int data, const void* poin
 	}
 
 	return TRUE;
+#endif
 }
 
 
@@ -4166,6 +4336,154 @@ bool CvTwoLayerPathFinder::GenerateUnitPath(const CvUnit* pkUnit, int iXstart, i
 // CvStepPathFinder
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+//	--------------------------------------------------------------------------------
+/// Constructor
+CvStepPathFinder::CvStepPathFinder() : m_uiComponentClock(0)
+{
+	for (int iI = 0; iI < NUM_STEP_COMPONENT_CACHE_ENTRIES; iI++)
+	{
+		m_aComponentCache[iI].m_ePlayer = NO_PLAYER;
+		m_aComponentCache[iI].m_eEnemy = NO_PLAYER;
+		m_aComponentCache[iI].m_uiStamp = 0;
+		m_aComponentCache[iI].m_uiLastUsed = 0;
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Returns the connected components of ePlayer's step passability map (against eEnemy), rebuilding them if the map has changed since they were labelled
+const std::vector<int>& CvStepPathFinder::GetStepComponents(PlayerTypes ePlayer, PlayerTypes eEnemy)
+{
+	CvMap& kMap = GC.getMap();
+	const uint uiStamp = kMap.GetStepPassabilityStamp();
+	const int iNumPlots = int(kMap.numPlots());
+	m_uiComponentClock++;
+
+	// Reuse an up to date labelling if we have one, otherwise overwrite the least recently used entry
+	StepComponents* pEntry = &m_aComponentCache[0];
+	for (int iI = 0; iI < NUM_STEP_COMPONENT_CACHE_ENTRIES; iI++)
+	{
+		StepComponents& kLoopEntry = m_aComponentCache[iI];
+		if (kLoopEntry.m_ePlayer == ePlayer && kLoopEntry.m_eEnemy == eEnemy)
+		{
+			pEntry = &kLoopEntry;
+			if (kLoopEntry.m_uiStamp == uiStamp && int(kLoopEntry.m_aiLabels.size()) == iNumPlots)
+			{
+				kLoopEntry.m_uiLastUsed = m_uiComponentClock;
+				return kLoopEntry.m_aiLabels;
+			}
+			break;
+		}
+		if (kLoopEntry.m_uiLastUsed < pEntry->m_uiLastUsed)
+		{
+			pEntry = &kLoopEntry;
+		}
+	}
+
+	pEntry->m_ePlayer = ePlayer;
+	pEntry->m_eEnemy = eEnemy;
+	pEntry->m_uiStamp = uiStamp;
+	pEntry->m_uiLastUsed = m_uiComponentClock;
+
+	// -2 = not yet visited, -1 = StepValid() would reject the plot
+	std::vector<int>& aiLabels = pEntry->m_aiLabels;
+	aiLabels.assign(iNumPlots, -2);
+	std::vector<int> aiOpen;
+	aiOpen.reserve(iNumPlots);
+	int iNextLabel = 0;
+
+	for (int iSeed = 0; iSeed < iNumPlots; iSeed++)
+	{
+		if (aiLabels[iSeed] != -2)
+			continue;
+
+		CvPlot* pSeedPlot = kMap.plotByIndexUnchecked(iSeed);
+		if (!IsStepPlotPassable(pSeedPlot, ePlayer, eEnemy))
+		{
+			aiLabels[iSeed] = -1;
+			continue;
+		}
+
+		// Flood fill through passable neighbors in the same area, exactly the steps StepValid() allows
+		aiLabels[iSeed] = iNextLabel;
+		aiOpen.push_back(iSeed);
+		while (!aiOpen.empty())
+		{
+			CvPlot* pLoopPlot = kMap.plotByIndexUnchecked(aiOpen.back());
+			aiOpen.pop_back();
+			const int iArea = pLoopPlot->getArea();
+
+			for (int iDirection = 0; iDirection < NUM_DIRECTION_TYPES; iDirection++)
+			{
+				CvPlot* pAdjacentPlot = plotDirection(pLoopPlot->getX(), pLoopPlot->getY(), (DirectionTypes)iDirection);
+				if (pAdjacentPlot == NULL || pAdjacentPlot->getArea() != iArea)
+					continue;
+
+				const int iAdjacentIndex = int(kMap.plotNum(pAdjacentPlot->getX(), pAdjacentPlot->getY()));
+				if (aiLabels[iAdjacentIndex] != -2)
+					continue;
+
+				if (IsStepPlotPassable(pAdjacentPlot, ePlayer, eEnemy))
+				{
+					aiLabels[iAdjacentIndex] = iNextLabel;
+					aiOpen.push_back(iAdjacentIndex);
+				}
+				else
+				{
+					aiLabels[iAdjacentIndex] = -1;
+				}
+			}
+		}
+		iNextLabel++;
+	}
+
+	return aiLabels;
+}
+
+//	--------------------------------------------------------------------------------
+/// Can a step path from pStartPlot reach pEndPlot at all? Answers without running A*, but does not leave a path behind in GetLastNode()
+bool CvStepPathFinder::ArePlotsConnected(PlayerTypes ePlayer, PlayerTypes eEnemy, const CvPlot* pStartPlot, const CvPlot* pEndPlot)
+{
+	if (pStartPlot == NULL || pEndPlot == NULL || pStartPlot->getArea() != pEndPlot->getArea())
+	{
+		return false;
+	}
+
+	// Only the stock step rules are labelled; anything else (or a zero length path) is left to A*
+	if (pStartPlot == pEndPlot || GetValidFunc() != StepValid || GetDestValidFunc() != StepDestValid)
+	{
+		SetData(&eEnemy);
+		return GeneratePath(pStartPlot->getX(), pStartPlot->getY(), pEndPlot->getX(), pEndPlot->getY(), ePlayer, false);
+	}
+
+	CvMap& kMap = GC.getMap();
+	const std::vector<int>& aiLabels = GetStepComponents(ePlayer, eEnemy);
+	const int iEndLabel = aiLabels[int(kMap.plotNum(pEndPlot->getX(), pEndPlot->getY()))];
+	if (iEndLabel < 0)
+	{
+		return false;
+	}
+
+	if (aiLabels[int(kMap.plotNum(pStartPlot->getX(), pStartPlot->getY()))] == iEndLabel)
+	{
+		return true;
+	}
+
+	// The start plot is always accepted by StepValid(), even if it is impassable itself, so its first step can enter any adjacent component
+	for (int iDirection = 0; iDirection < NUM_DIRECTION_TYPES; iDirection++)
+	{
+		CvPlot* pAdjacentPlot = plotDirection(pStartPlot->getX(), pStartPlot->getY(), (DirectionTypes)iDirection);
+		if (pAdjacentPlot != NULL && pAdjacentPlot->getArea() == pStartPlot->getArea() &&
+			aiLabels[int(kMap.plotNum(pAdjacentPlot->getX(), pAdjacentPlot->getY()))] == iEndLabel)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#endif
 //	--------------------------------------------------------------------------------
 /// Get distance between two plots on same land mass (return -1 if plots are in different areas)
 int CvStepPathFinder::GetStepDistanceBetweenPoints(PlayerTypes ePlayer, PlayerTypes eEnemy, CvPlot* pStartPlot, CvPlot* pEndPlot)
@@ -4178,6 +4496,13 @@ int CvStepPathFinder::GetStepDistanceBetweenPoints(PlayerTypes ePlayer, PlayerTy
 	{
 		return -1;
 	}
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	// Callers read the path back from GetLastNode(), so only the negative answer can skip A*
+	if (pStartPlot != pEndPlot && !ArePlotsConnected(ePlayer, eEnemy, pStartPlot, pEndPlot))
+	{
+		return -1;
+	}
+#endif
 
 	SetData(&eEnemy);
 #ifdef AUI_ASTAR_MINOR_OPTIMIZATION
@@ -4208,6 +4533,13 @@ bool CvStepPathFinder::DoesPathExist(PlayerTypes ePlayer, PlayerTypes eEnemy, Cv
 	{
 		return false;
 	}
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	// Callers read the path back from GetLastNode(), so only the negative answer can skip A*
+	if (pStartPlot != pEndPlot && !ArePlotsConnected(ePlayer, eEnemy, pStartPlot, pEndPlot))
+	{
+		return false;
+	}
+#endif
 
 	SetData(&eEnemy);
 	return GeneratePath(pStartPlot->getX(), pStartPlot->getY(), pEndPlot->getX(), pEndPlot->getY(), ePlayer, false);
@@ -5533,6 +5865,66 @@ bool CanReachInXTurns(UnitHandle pUnit, CvPlot* pTarget, int iTurns, bool bIgnor
 	}
 }
 
+#ifdef AUI_ASTAR_REACHABILITY_MEMO
+//	--------------------------------------------------------------------------------
+// The AI asks for the same unit-to-plot turn counts many times while it scores targets, so answers are kept until something that could change them happens.
+// Plot changes (units moving or dying, ownership, visibility, improvements) are caught by the map's plot change stamp; the unit's own moves, damage and
+// promotions are part of the key. Danger updates and war/open borders changes call InvalidateReachabilityMemo() explicitly.
+// A single flood per unit can't replace these queries: the destination plot is costed differently (attacks, stacking, PathDestValid) from the plots on the way.
+struct ReachabilityMemoKey
+{
+	int m_iValues[10];
+
+	bool operator<(const ReachabilityMemoKey& rhs) const
+	{
+		return memcmp(m_iValues, rhs.m_iValues, sizeof(m_iValues)) < 0;
+	}
+};
+typedef std::map<ReachabilityMemoKey, int> ReachabilityMemo;
+
+static ReachabilityMemo s_ReachabilityMemo;
+static uint s_uiReachabilityMemoStamp = 0;
+static int s_iReachabilityMemoTurn = -1;
+
+static const uint MAX_REACHABILITY_MEMO_ENTRIES = 32768;
+
+//	--------------------------------------------------------------------------------
+void InvalidateReachabilityMemo()
+{
+	s_ReachabilityMemo.clear();
+}
+
+//	--------------------------------------------------------------------------------
+static void ValidateReachabilityMemo()
+{
+	uint uiStamp = GC.getMap().GetPlotChangeStamp();
+	int iTurn = GC.getGame().getGameTurn();
+	if (uiStamp != s_uiReachabilityMemoStamp || iTurn != s_iReachabilityMemoTurn || s_ReachabilityMemo.size() >= MAX_REACHABILITY_MEMO_ENTRIES)
+	{
+		s_ReachabilityMemo.clear();
+		s_uiReachabilityMemoStamp = uiStamp;
+		s_iReachabilityMemoTurn = iTurn;
+	}
+}
+
+//	--------------------------------------------------------------------------------
+static ReachabilityMemoKey GetReachabilityMemoKey(const CvUnit* pUnit, const CvPlot* pTarget, const CvPlot* pFromPlot, bool bIgnoreUnits, bool bIgnoreStacking, int iTargetTurns)
+{
+	ReachabilityMemoKey kKey;
+	kKey.m_iValues[0] = (int)pUnit->getOwner();
+	kKey.m_iValues[1] = pUnit->GetID();
+	kKey.m_iValues[2] = (int)pFromPlot->GetPlotIndex();
+	kKey.m_iValues[3] = (int)pTarget->GetPlotIndex();
+	kKey.m_iValues[4] = (bIgnoreUnits ? 1 : 0) | (bIgnoreStacking ? 2 : 0);
+	kKey.m_iValues[5] = iTargetTurns;
+	kKey.m_iValues[6] = pUnit->getMoves();
+	kKey.m_iValues[7] = pUnit->maxMoves();
+	kKey.m_iValues[8] = pUnit->getDamage();
+	kKey.m_iValues[9] = pUnit->getLevel();
+	return kKey;
+}
+#endif
+
 #if defined(AUI_ASTAR_TURN_LIMITER)
 // Delnar: if you're checking if a unit can reach a tile within X turns, set the iTargetTurns parameter to X to speed up the pathfinder
 int TurnsToReachTarget(UnitHandle pUnit, const CvPlot* pTarget, bool bReusePaths, bool bIgnoreUnits, bool bIgnoreStacking, int iTargetTurns)
@@ -5566,6 +5958,16 @@ int TurnsToReachTarget(UnitHandle pUnit, CvPlot* pTarget, bool bReusePaths, bool
 	if(pUnit)
 #endif
 	{
+#ifdef AUI_ASTAR_REACHABILITY_MEMO
+		ValidateReachabilityMemo();
+		ReachabilityMemoKey kMemoKey = GetReachabilityMemoKey(pUnit.pointer(), pTarget, (pFromPlot ? pFromPlot : pUnit->plot()), bIgnoreUnits, bIgnoreStacking, iTargetTurns);
+		ReachabilityMemo::const_iterator itMemo = s_ReachabilityMemo.find(kMemoKey);
+		if (itMemo != s_ReachabilityMemo.end())
+		{
+			return itMemo->second;
+		}
+
+#endif
 #ifdef PATH_FINDER_LOGGING
 		CvString strBaseString;
 		cvStopWatch kTimer(strBaseString, "Pathfinder.csv");
@@ -5662,6 +6064,9 @@ int TurnsToReachTarget(UnitHandle pUnit, CvPlot* pTarget, bool bReusePaths, bool
 				}
 			}
 		}
+#ifdef AUI_ASTAR_REACHABILITY_MEMO
+		s_ReachabilityMemo[kMemoKey] = rtnValue;
+#endif
 
 #ifdef PATH_FINDER_LOGGING
 		// NOTE: because I'm creating the string after the cvStopWatch, the time it takes to create the string will be in the timer.
@@ -400,6 +400,16 @@ protected:
 	void UpdateOpenNode(CvAStarNode* node);
 	void UpdateParents(CvAStarNode* node);
 
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+	inline bool IsOpenHeapBefore(const CvAStarNode* pLeft, const CvAStarNode* pRight) const
+	{
+		return (pLeft->m_iTotalCost < pRight->m_iTotalCost || (pLeft->m_iTotalCost == pRight->m_iTotalCost && pLeft->m_uiOpenSequence < pRight->m_uiOpenSequence));
+	}
+	void PushOpenHeap(CvAStarNode* node);
+	void OpenHeapSiftUp(uint uiIndex);
+	void OpenHeapSiftDown(uint uiIndex);
+#endif
+
 	void Push(CvAStarNode* node);
 	CvAStarNode* Pop();
 
@@ -453,8 +463,13 @@ protected:
 	bool m_bIsMultiplayer;
 #endif
 
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+	std::vector<CvAStarNode*> m_apOpenHeap;	// The open list, as a binary min-heap ordered by total cost, then by sequence
+	uint m_uiOpenSequence;					// Incremented every time a node is added to the open list or has its cost lowered
+#else
 	CvAStarNode* m_pOpen;            // The open list
 	CvAStarNode* m_pOpenTail;        // The open list tail pointer (to speed up inserts)
+#endif
 	CvAStarNode* m_pClosed;          // The closed list
 	CvAStarNode* m_pBest;            // The best node
 	CvAStarNode* m_pStackHead;		// The Push/Pop stack head
@@ -630,6 +645,9 @@ int TurnsToReachTargetFromPlot(UnitHandle pUnit, const CvPlot* pTarget, const Cv
 int TurnsToReachTarget(UnitHandle pUnit, CvPlot* pTarget, bool bReusePaths=false, bool bIgnoreUnits=false, bool bIgnoreStacking=false);
 #endif
 bool CanReachInXTurns(UnitHandle pUnit, CvPlot* pTarget, int iTurns, bool bIgnoreUnits=false, int* piTurns = NULL);
+#ifdef AUI_ASTAR_REACHABILITY_MEMO
+void InvalidateReachabilityMemo();
+#endif
 int TradeRouteHeuristic(int iFromX, int iFromY, int iToX, int iToY);
 int TradeRouteLandPathCost(CvAStarNode* parent, CvAStarNode* node, int data, const void* pointer, CvAStar* finder);
 int TradeRouteLandValid(CvAStarNode* parent, CvAStarNode* node, int data, const void* pointer, CvAStar* finder);
@@ -675,10 +693,32 @@ private:
 class CvStepPathFinder: public CvAStar
 {
 public:
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	CvStepPathFinder();
+	bool ArePlotsConnected(PlayerTypes ePlayer, PlayerTypes eEnemy, const CvPlot* pStartPlot, const CvPlot* pEndPlot);
+#endif
 	int GetStepDistanceBetweenPoints(PlayerTypes ePlayer, PlayerTypes eEnemy, CvPlot* pStartPlot, CvPlot* pEndPlot);
 	bool DoesPathExist(PlayerTypes ePlayer, PlayerTypes eEnemy, CvPlot* pStartPlot, CvPlot* pEndPlot);
 	CvPlot* GetLastOwnedPlot(PlayerTypes ePlayer, PlayerTypes eEnemy, CvPlot* pStartPlot, CvPlot* pEndPlot) const;
 	CvPlot* GetXPlotsFromEnd(PlayerTypes ePlayer, PlayerTypes eEnemy, CvPlot* pStartPlot, CvPlot* pEndPlot, int iPlotsFromEnd, bool bLeaveEnemyTerritory) const;
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+
+protected:
+	enum { NUM_STEP_COMPONENT_CACHE_ENTRIES = 8 };
+	// Connected components of one player/enemy passability map; plots StepValid() rejects are labelled -1
+	struct StepComponents
+	{
+		PlayerTypes m_ePlayer;
+		PlayerTypes m_eEnemy;
+		uint m_uiStamp;
+		uint m_uiLastUsed;
+		std::vector<int> m_aiLabels;
+	};
+	const std::vector<int>& GetStepComponents(PlayerTypes ePlayer, PlayerTypes eEnemy);
+
+	StepComponents m_aComponentCache[NUM_STEP_COMPONENT_CACHE_ENTRIES];
+	uint m_uiComponentClock;
+#endif
 };
 
 class CvIgnoreUnitsPathFinder: public CvAStar
@@ -105,6 +105,10 @@ public:
 		m_pNext = NULL;
 		m_pPrev = NULL;
 		m_pStack = NULL;
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+		m_iHeapIndex = -1;
+		m_uiOpenSequence = 0;
+#endif
 #endif
 #ifdef AUI_ASTAR_PRECALCULATE_NEIGHBORS_ON_INITIALIZE
 		for (int iI = 0; iI < NUM_DIRECTION_TYPES; iI++)
@@ -143,6 +147,10 @@ public:
 		m_pNext = NULL;
 		m_pPrev = NULL;
 		m_pStack = NULL;
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+		m_iHeapIndex = -1;
+		m_uiOpenSequence = 0;
+#endif
 
 #ifdef AUI_ASTAR_FIX_CAN_ENTER_TERRAIN_NO_DUPLICATE_CALLS
 #ifdef AUI_ASTAR_MINOR_OPTIMIZATION
@@ -173,6 +181,10 @@ public:
 	CvAStarNode* m_pNext;					// For Open and Closed lists
 	CvAStarNode* m_pPrev;					// For Open and Closed lists
 	CvAStarNode* m_pStack;					// For Push/Pop Stack
+#ifdef AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+	int m_iHeapIndex;						// Position in the open list heap (only valid while the node is in the open list)
+	uint m_uiOpenSequence;					// Tiebreaker for nodes with equal total cost, so the heap pops them in the same order as the sorted list did
+#endif
 
 #ifdef AUI_ASTAR_MINOR_OPTIMIZATION
 	FStaticVector<CvAStarNode*, NUM_DIRECTION_TYPES, true, c_eCiv5GameplayDLL, 0> m_apChildren;
@@ -318,6 +318,11 @@ void CvBarbarians::DoCamps()
 	if(eCamp != NO_IMPROVEMENT)
 	{
 		CvMap& kMap = GC.getMap();
+#ifdef AUI_BARBARIANS_CAMP_CANDIDATE_SET
+		// Plots that pass every check below that can't change while camps are being placed, so the plot-finding rolls only ever land on plausible spots
+		std::vector<CvPlot*> apCampCandidates;
+		std::vector<CvPlot*> apCoastalCampCandidates;
+#endif
 		// Figure out how many Nonvisible tiles we have to base # of camps to spawn on
 #ifdef AUI_WARNING_FIXES
 		for (uint iI = 0; iI < kMap.numPlots(); iI++)
@@ -338,6 +343,16 @@ void CvBarbarians::DoCamps()
 				if(!pLoopPlot->isVisibleToCivTeam())
 				{
 					iNumNotVisiblePlots++;
+#ifdef AUI_BARBARIANS_CAMP_CANDIDATE_SET
+					if (!pLoopPlot->isImpassable() && !pLoopPlot->isMountain() && !pLoopPlot->isOwned() && pLoopPlot->getResourceType() == NO_RESOURCE &&
+						pLoopPlot->getImprovementType() == NO_IMPROVEMENT && kMap.getArea(pLoopPlot->getArea())->getNumTiles() > 1 &&
+						(pLoopPlot->getFeatureType() == NO_FEATURE || !GC.getFeatureInfo(pLoopPlot->getFeatureType())->isNoImprovement()))
+					{
+						apCampCandidates.push_back(pLoopPlot);
+						if (pLoopPlot->isCoastalLand())
+							apCoastalCampCandidates.push_back(pLoopPlot);
+					}
+#endif
 				}
 			}
 		}
@@ -376,7 +391,9 @@ void CvBarbarians::DoCamps()
 			// Don't want to get stuck in an infinite or almost so loop
 			int iCount = 0;
 			int iPlotIndex = -1;
+#ifndef AUI_BARBARIANS_CAMP_CANDIDATE_SET
 			int iNumPlots = kMap.numPlots();
+#endif
 
 			UnitTypes eBestUnit;
 
@@ -403,9 +420,22 @@ void CvBarbarians::DoCamps()
 			{
 				iCount++;
 
+#ifdef AUI_BARBARIANS_CAMP_CANDIDATE_SET
+				// Draw without replacement; a plot that fails here won't pass later in the same turn either
+				std::vector<CvPlot*>& apCandidates = bWantsCoastal ? apCoastalCampCandidates : apCampCandidates;
+				if (apCandidates.empty())
+					break;
+
+				iPlotIndex = kGame.getJonRandNum(int(apCandidates.size()), "Barb Camp Plot-Finding Roll");
+
+				pLoopPlot = apCandidates[iPlotIndex];
+				apCandidates[iPlotIndex] = apCandidates.back();
+				apCandidates.pop_back();
+#else
 				iPlotIndex = kGame.getJonRandNum(iNumPlots, "Barb Camp Plot-Finding Roll");
 
 				pLoopPlot = kMap.plotByIndex(iPlotIndex);
+#endif
 
 				// Plot must be valid (not Water, nonvisible)
 				if(!pLoopPlot->isWater())
@@ -2480,7 +2480,11 @@ bool CvCityBuildings::IsBuildingSellable(const CvBuildingEntry& kBuilding) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityBuildingsIsBuildingSellable"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(m_pCity->getOwner());
@@ -3089,6 +3093,9 @@ void CvCityBuildings::SetBuildingGreatWork(BuildingClassTypes eBuildingClass, in
 				if (iGreatWorkIndex == -1)
 				{
 					m_aBuildingGreatWork.erase(it);
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+					m_pCity->invalidateBaseYieldRateCache();
+#endif
 				}
 				else
 				{
@@ -3109,6 +3116,9 @@ void CvCityBuildings::SetBuildingGreatWork(BuildingClassTypes eBuildingClass, in
 		kWork.iGreatWorkIndex = iGreatWorkIndex;
 		m_aBuildingGreatWork.push_back(kWork);
 	}
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	m_pCity->invalidateBaseYieldRateCache();
+#endif
 
 	GC.GetEngineUserInterface()->setDirty(CityInfo_DIRTY_BIT, true);
 }
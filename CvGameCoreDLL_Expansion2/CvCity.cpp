@@ -437,6 +437,9 @@ void CvCity::init(int iID, PlayerTypes eOwner, int iX, int iY, bool bBumpUnits,
 	GC.getGame().changeNumCities(1);
 	// Tell the city manager now as well.
 	CvCityManager::OnCityCreated(this);
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	GC.getGame().InvalidatePlayerCityLayout(getOwner());
+#endif
 
 	int iGameTurn = GC.getGame().getGameTurn();
 	setGameTurnFounded(iGameTurn);
@@ -952,6 +955,14 @@ void CvCity::reset(int iID, PlayerTypes eOwner, int iX, int iY, bool bConstructo
 		m_aiBaseYieldRank.setAt(iI, -1);
 		m_aiYieldRank.setAt(iI, -1);
 	}
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	invalidateBaseYieldRateCache();
+	m_uiTradeValuesCacheRevision = 0;
+	for(iI = 0; iI < NUM_YIELD_TYPES; iI++)
+	{
+		m_aiCachedTradeValuesTimes100[iI] = 0;
+	}
+#endif
 
 	if(!bConstructorCall)
 	{
@@ -2747,7 +2758,11 @@ bool CvCity::canTrain(UnitTypes eUnit, bool bContinue, bool bTestVisible, bool b
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityCanTrain"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -2965,7 +2980,11 @@ bool CvCity::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestVis
 
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityCanConstruct"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -3000,7 +3019,11 @@ bool CvCity::canCreate(ProjectTypes eProject, bool bContinue, bool bTestVisible)
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityCanCreate"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -3035,7 +3058,11 @@ bool CvCity::canPrepare(SpecialistTypes eSpecialist, bool bContinue) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityCanPrepare"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -3069,7 +3096,11 @@ bool CvCity::canMaintain(ProcessTypes eProcess, bool bContinue) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityCanMaintain"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -5820,7 +5851,11 @@ int CvCity::getProductionDifferenceTimes100(int /*iProductionNeeded*/, int /*iPr
 	iModifiedProduction += iOverflow;
 	iModifiedProduction += iFoodProduction;
 
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	int iTradeYield = GetTradeValuesAtCityTimes100(YIELD_PRODUCTION);
+#else
 	int iTradeYield = GET_PLAYER(m_eOwner).GetTrade()->GetTradeValuesAtCityTimes100(this, YIELD_PRODUCTION);
+#endif
 	iModifiedProduction += iTradeYield;
 
 	// NQMP GJS - Military Caste
@@ -6892,6 +6927,9 @@ void CvCity::processSpecialist(SpecialistTypes eSpecialist, int iChange)
 {
 	VALIDATE_OBJECT
 	int iI;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	GET_PLAYER(getOwner()).InvalidateCityUnhappinessTerms();
+#endif
 
 	CvSpecialistInfo* pkSpecialist = GC.getSpecialistInfo(eSpecialist);
 	if(pkSpecialist == NULL)
@@ -6929,6 +6967,9 @@ void CvCity::UpdateReligion(ReligionTypes eNewMajority)
 	{
 		m_aiBaseYieldRateFromReligion[iYield] = 0;
 	}
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	invalidateBaseYieldRateCache();
+#endif
 
 	for(int iYield = 0; iYield < NUM_YIELD_TYPES; iYield++)
 	{
@@ -7869,6 +7910,9 @@ void CvCity::setPopulation(int iNewValue, bool bReassignPop /* = true */)
 		}
 
 		m_iPopulation = iNewValue;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+		GET_PLAYER(getOwner()).InvalidateCityUnhappinessTerms();
+#endif
 
 		CvAssert(getPopulation() >= 0);
 
@@ -7937,7 +7981,11 @@ void CvCity::setPopulation(int iNewValue, bool bReassignPop /* = true */)
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("SetPopulation"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getX());
@@ -8193,7 +8241,11 @@ void CvCity::DoJONSCultureLevelIncrease()
 		DoAcquirePlot(pPlotToAcquire->getX(), pPlotToAcquire->getY());
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityBoughtPlot"))
+#else
 		if (pkScriptSystem) 
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(getOwner());
@@ -8818,7 +8870,12 @@ void CvCity::ChangeNoOccupiedUnhappinessCount(int iChange)
 {
 	VALIDATE_OBJECT
 	if(iChange != 0)
+	{
 		m_iNoOccupiedUnhappinessCount += iChange;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+		GET_PLAYER(getOwner()).InvalidateCityUnhappinessTerms();
+#endif
+	}
 }
 
 
@@ -9254,6 +9311,9 @@ void CvCity::SetOccupied(bool bValue)
 	if(IsOccupied() != bValue)
 	{
 		m_bOccupied = bValue;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+		GET_PLAYER(getOwner()).InvalidateCityUnhappinessTerms();
+#endif
 	}
 }
 
@@ -9273,6 +9333,9 @@ void CvCity::SetPuppet(bool bValue)
 	if(IsPuppet() != bValue)
 	{
 		m_bPuppet = bValue;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+		GET_PLAYER(getOwner()).InvalidateCityUnhappinessTerms();
+#endif
 #ifdef AUI_CITIZENS_PUPPET_AND_ANNEX_REALLOCATES_CITIZENS
 		if (GetCityCitizens())
 		{
@@ -9608,6 +9671,9 @@ bool CvCity::IsIgnoreCityForHappiness() const
 void CvCity::SetIgnoreCityForHappiness(bool bValue)
 {
 	m_bIgnoreCityForHappiness = bValue;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	GET_PLAYER(getOwner()).InvalidateCityUnhappinessTerms();
+#endif
 }
 
 // NQMP GJS - Oligarchy free walls
@@ -10385,7 +10451,11 @@ int CvCity::getYieldRateTimes100(YieldTypes eIndex, bool bIgnoreTrade) const
 
 	if (!bIgnoreTrade)
 	{
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+		int iTradeYield = GetTradeValuesAtCityTimes100(eIndex);
+#else
 		int iTradeYield = GET_PLAYER(m_eOwner).GetTrade()->GetTradeValuesAtCityTimes100(this, eIndex);
+#endif
 		iModifiedYield += iTradeYield;
 	}
 
@@ -10400,6 +10470,21 @@ int CvCity::getBaseYieldRate(YieldTypes eIndex) const
 	CvAssertMsg(eIndex >= 0, "eIndex expected to be >= 0");
 	CvAssertMsg(eIndex < NUM_YIELD_TYPES, "eIndex expected to be < NUM_YIELD_TYPES");
 
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	if (m_abBaseYieldRateDirty[eIndex])
+	{
+		int iSum = 0;
+		iSum += GetBaseYieldRateFromTerrain(eIndex);
+		iSum += GetBaseYieldRateFromBuildings(eIndex);
+		iSum += GetBaseYieldRateFromSpecialists(eIndex);
+		iSum += GetBaseYieldRateFromMisc(eIndex);
+		iSum += GetBaseYieldRateFromReligion(eIndex);
+		iSum += GetBaseYieldRateFromGreatWorks(eIndex); // NQMP GJS - Artistic Genius fix to add science to Great Works
+		m_aiCachedBaseYieldRate[eIndex] = iSum;
+		m_abBaseYieldRateDirty[eIndex] = false;
+	}
+	int iValue = m_aiCachedBaseYieldRate[eIndex];
+#else
 	int iValue = 0;
 	iValue += GetBaseYieldRateFromTerrain(eIndex);
 	iValue += GetBaseYieldRateFromBuildings(eIndex);
@@ -10407,6 +10492,7 @@ int CvCity::getBaseYieldRate(YieldTypes eIndex) const
 	iValue += GetBaseYieldRateFromMisc(eIndex);
 	iValue += GetBaseYieldRateFromReligion(eIndex);
 	iValue += GetBaseYieldRateFromGreatWorks(eIndex); // NQMP GJS - Artistic Genius fix to add science to Great Works
+#endif
 #ifdef AUI_PLOT_FIX_CITY_YIELD_CHANGE_RELOCATED
 	// Coastal City Mod
 	if (isCoastal())
@@ -10452,6 +10538,9 @@ void CvCity::ChangeBaseYieldRateFromTerrain(YieldTypes eIndex, int iChange)
 	if(iChange != 0)
 	{
 		m_aiBaseYieldRateFromTerrain.setAt(eIndex, m_aiBaseYieldRateFromTerrain[eIndex] + iChange);
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+		m_abBaseYieldRateDirty[eIndex] = true;
+#endif
 
 		// JAR - debugging
 		s_lastYieldUsedToUpdateRateFromTerrain = eIndex;
@@ -10490,6 +10579,9 @@ void CvCity::ChangeBaseYieldRateFromBuildings(YieldTypes eIndex, int iChange)
 	if(iChange != 0)
 	{
 		m_aiBaseYieldRateFromBuildings.setAt(eIndex, m_aiBaseYieldRateFromBuildings[eIndex] + iChange);
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+		m_abBaseYieldRateDirty[eIndex] = true;
+#endif
 
 		if(getTeam() == GC.getGame().getActiveTeam())
 		{
@@ -10524,6 +10616,9 @@ void CvCity::ChangeBaseYieldRateFromSpecialists(YieldTypes eIndex, int iChange)
 	if(iChange != 0)
 	{
 		m_aiBaseYieldRateFromSpecialists.setAt(eIndex, m_aiBaseYieldRateFromSpecialists[eIndex] + iChange);
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+		m_abBaseYieldRateDirty[eIndex] = true;
+#endif
 
 		if(getTeam() == GC.getGame().getActiveTeam())
 		{
@@ -10557,6 +10652,9 @@ void CvCity::ChangeBaseYieldRateFromMisc(YieldTypes eIndex, int iChange)
 	if(iChange != 0)
 	{
 		m_aiBaseYieldRateFromMisc.setAt(eIndex, m_aiBaseYieldRateFromMisc[eIndex] + iChange);
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+		m_abBaseYieldRateDirty[eIndex] = true;
+#endif
 
 		if(getTeam() == GC.getGame().getActiveTeam())
 		{
@@ -10590,6 +10688,9 @@ void CvCity::ChangeBaseYieldRateFromReligion(YieldTypes eIndex, int iChange)
 	if(iChange != 0)
 	{
 		m_aiBaseYieldRateFromReligion[eIndex] = m_aiBaseYieldRateFromReligion[eIndex] + iChange;
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+		m_abBaseYieldRateDirty[eIndex] = true;
+#endif
 
 		if(getTeam() == GC.getGame().getActiveTeam())
 		{
@@ -10818,7 +10919,11 @@ void CvCity::changeProductionToYieldModifier(YieldTypes eIndex, int iChange)
 //	--------------------------------------------------------------------------------
 int CvCity::GetTradeYieldModifier(YieldTypes eIndex, CvString* toolTipSink) const
 {
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	int iReturnValue = GetTradeValuesAtCityTimes100(eIndex);
+#else
 	int iReturnValue = GET_PLAYER(m_eOwner).GetTrade()->GetTradeValuesAtCityTimes100(this, eIndex);
+#endif
 	if (toolTipSink)
 	{
 		if (iReturnValue != 0)
@@ -11457,6 +11562,9 @@ void CvCity::updateStrengthValue()
 	{
 		m_iStrengthValue += /*3*/ GC.getCITY_STRENGTH_HILL_CHANGE();
 	}
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	GC.getGame().InvalidateCityDefenseMilitaryStrength(getOwner());
+#endif
 
 	DLLUI->setDirty(CityInfo_DIRTY_BIT, true);
 }
@@ -11564,6 +11672,9 @@ void CvCity::setDamage(int iValue, bool noMessage)
 			DLLUI->AddPopupText(m_iX, m_iY, text, fDelay);
 		}
 		m_iDamage = iValue;
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+		GC.getGame().InvalidateCityDefenseMilitaryStrength(getOwner());
+#endif
 	}
 }
 
@@ -11645,7 +11756,11 @@ bool CvCity::CanBuyPlot(int iPlotX, int iPlotY, bool bIgnoreCost)
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityCanBuyPlot"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -11685,7 +11800,11 @@ bool CvCity::CanBuyAnyPlot(void)
 	CvMap& thisMap = GC.getMap();
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityCanBuyAnyPlot"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -11920,7 +12039,11 @@ void CvCity::GetBuyablePlotList(std::vector<int>& aiPlotList)
 #endif
 
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityCanAcquirePlot"))
+#else
 				if (pkScriptSystem) 
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(getOwner());
@@ -12485,7 +12608,11 @@ void CvCity::BuyPlot(int iPlotX, int iPlotY)
 	DoAcquirePlot(iPlotX, iPlotY);
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityBoughtPlot"))
+#else
 	if (pkScriptSystem) 
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -13030,7 +13157,11 @@ void CvCity::popOrder(int iNum, bool bFinish, bool bChoose)
 			if(iResult != FFreeList::INVALID_INDEX)
 			{
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityTrained"))
+#else
 				if (pkScriptSystem) 
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(getOwner());
@@ -13101,7 +13232,11 @@ void CvCity::popOrder(int iNum, bool bFinish, bool bChoose)
 #endif
 
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityConstructed"))
+#else
 				if (pkScriptSystem) 
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(getOwner());
@@ -13176,7 +13311,11 @@ void CvCity::popOrder(int iNum, bool bFinish, bool bChoose)
 #endif
 
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityCreated"))
+#else
 			if (pkScriptSystem) 
+#endif
 			{
 				CvLuaArgsHandle args;
 				args->Push(getOwner());
@@ -14150,7 +14289,11 @@ void CvCity::Purchase(UnitTypes eUnitType, BuildingTypes eBuildingType, ProjectT
 				}
 
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityTrained"))
+#else
 				if (pkScriptSystem) 
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(getOwner());
@@ -14169,7 +14312,11 @@ void CvCity::Purchase(UnitTypes eUnitType, BuildingTypes eBuildingType, ProjectT
 			bResult = CreateBuilding(eBuildingType);
 
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityConstructed"))
+#else
 			if (pkScriptSystem) 
+#endif
 			{
 				CvLuaArgsHandle args;
 				args->Push(getOwner());
@@ -14191,7 +14338,11 @@ void CvCity::Purchase(UnitTypes eUnitType, BuildingTypes eBuildingType, ProjectT
 			CvAssertMsg(bResult, "Unable to create project");
 
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityCreated"))
+#else
 			if (pkScriptSystem) 
+#endif
 			{
 				CvLuaArgsHandle args;
 				args->Push(getOwner());
@@ -14232,7 +14383,11 @@ void CvCity::Purchase(UnitTypes eUnitType, BuildingTypes eBuildingType, ProjectT
 			pUnit->setMoves(0);
 
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityTrained"))
+#else
 			if (pkScriptSystem) 
+#endif
 			{
 				CvLuaArgsHandle args;
 				args->Push(getOwner());
@@ -14363,7 +14518,11 @@ void CvCity::Purchase(UnitTypes eUnitType, BuildingTypes eBuildingType, ProjectT
 			CvAssertMsg(bResult, "Unable to create building");
 
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if (pkScriptSystem && LuaSupport::HasGameEventListeners("CityConstructed"))
+#else
 			if (pkScriptSystem)
+#endif
 			{
 				CvLuaArgsHandle args;
 				args->Push(getOwner());
@@ -15418,6 +15577,17 @@ void CvCity::read(FDataStream& kStream)
 		// Change all at once, rather than one by one, else the clamping might adjust the current damage.
 		ChangeExtraHitPoints(iTotalExtraHitPoints);
 	}
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+
+	invalidateBaseYieldRateCache();
+	m_uiTradeValuesCacheRevision = 0;
+#endif
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	GET_PLAYER(getOwner()).InvalidateCityUnhappinessTerms();
+#endif
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	GC.getGame().InvalidatePlayerCityLayout(getOwner());
+#endif
 
 	CvCityManager::OnCityCreated(this);
 }
@@ -15835,6 +16005,45 @@ void CvCity::invalidateYieldRankCache(YieldTypes eYield)
 	}
 }
 
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+//	--------------------------------------------------------------------------------
+/// Marks the cached sum returned by getBaseYieldRate() as stale; needs to be called whenever one of its components changes
+void CvCity::invalidateBaseYieldRateCache(YieldTypes eYield)
+{
+	CvAssertMsg(eYield >= NO_YIELD && eYield < NUM_YIELD_TYPES, "invalidateBaseYieldRateCache passed bogus yield index");
+
+	if(eYield == NO_YIELD)
+	{
+		for(int iI = 0; iI < NUM_YIELD_TYPES; iI++)
+		{
+			m_abBaseYieldRateDirty[iI] = true;
+		}
+	}
+	else
+	{
+		m_abBaseYieldRateDirty[eYield] = true;
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Yields this city gets from trade routes, only recounted after the game's trade routes changed
+int CvCity::GetTradeValuesAtCityTimes100(YieldTypes eYield) const
+{
+	uint uiRevision = GC.getGame().GetGameTrade()->GetRevision();
+	if(m_uiTradeValuesCacheRevision != uiRevision)
+	{
+		CvPlayerTrade* pPlayerTrade = GET_PLAYER(m_eOwner).GetTrade();
+		for(int iI = 0; iI < NUM_YIELD_TYPES; iI++)
+		{
+			m_aiCachedTradeValuesTimes100[iI] = pPlayerTrade->GetTradeValuesAtCityTimes100(this, (YieldTypes)iI);
+		}
+		m_uiTradeValuesCacheRevision = uiRevision;
+	}
+
+	return m_aiCachedTradeValuesTimes100[eYield];
+}
+#endif
+
 //	--------------------------------------------------------------------------------
 bool CvCity::isMadeAttack() const
 {
@@ -16976,6 +17185,9 @@ void CvCity::ChangeExtraHitPoints(int iValue)
 		FAssertMsg(m_iExtraHitPoints >= 0, "Trying to set ExtraHitPoints to a negative value");
 		if (m_iExtraHitPoints < 0)
 			m_iExtraHitPoints = 0;
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+		GC.getGame().InvalidateCityDefenseMilitaryStrength(getOwner());
+#endif
 
 		int iCurrentDamage = getDamage();
 		if (iCurrentDamage > GetMaxHitPoints())
@@ -893,6 +893,10 @@ public:
 
 	void invalidatePopulationRankCache();
 	void invalidateYieldRankCache(YieldTypes eYield = NO_YIELD);
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	void invalidateBaseYieldRateCache(YieldTypes eYield = NO_YIELD);
+	int GetTradeValuesAtCityTimes100(YieldTypes eYield) const;
+#endif
 
 	bool CommitToBuildingUnitForOperation();
 	UnitTypes GetUnitForOperation();
@@ -1098,6 +1102,12 @@ protected:
 	FAutoVariable<std::vector<bool>, CvCity> m_abBaseYieldRankValid;
 	FAutoVariable<std::vector<int>, CvCity> m_aiYieldRank;
 	FAutoVariable<std::vector<bool>, CvCity> m_abYieldRankValid;
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	mutable int m_aiCachedBaseYieldRate[NUM_YIELD_TYPES]; // not serialized, marked dirty on load
+	mutable bool m_abBaseYieldRateDirty[NUM_YIELD_TYPES];
+	mutable int m_aiCachedTradeValuesTimes100[NUM_YIELD_TYPES];
+	mutable uint m_uiTradeValuesCacheRevision;
+#endif
 
 	IDInfo m_combatUnit;		// The unit the city is in combat with
 
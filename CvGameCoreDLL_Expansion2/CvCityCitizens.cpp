@@ -1203,6 +1203,12 @@ BuildingTypes CvCityCitizens::GetAIBestSpecialistBuilding(int& iSpecialistValue)
 	SpecialistTypes eSpecialist;
 	int iValue;
 
+#ifdef AUI_CITIZENS_SHARED_SCAN_VALUES
+	// Specialist values only depend on the city's state, which doesn't change during this loop
+	std::vector<int> aiSpecialistValues(GC.getNumSpecialistInfos(), 0);
+	std::vector<bool> abSpecialistValueKnown(GC.getNumSpecialistInfos(), false);
+#endif
+
 	// Loop through all Buildings
 #ifdef AUI_WARNING_FIXES
 	for (uint iBuildingLoop = 0; iBuildingLoop < GC.getNumBuildingInfos(); iBuildingLoop++)
@@ -1231,6 +1237,22 @@ BuildingTypes CvCityCitizens::GetAIBestSpecialistBuilding(int& iSpecialistValue)
 						continue;
 #endif
 
+#ifdef AUI_CITIZENS_SHARED_SCAN_VALUES
+					if (eSpecialist >= 0 && eSpecialist < (int)aiSpecialistValues.size())
+					{
+						if (!abSpecialistValueKnown[eSpecialist])
+						{
+#ifdef AUI_CITIZENS_UNHARDCODE_SPECIALIST_VALUE_HAPPINESS
+							aiSpecialistValues[eSpecialist] = GetSpecialistValue(eSpecialist, bIsWorked);
+#else
+							aiSpecialistValues[eSpecialist] = GetSpecialistValue(eSpecialist);
+#endif
+							abSpecialistValueKnown[eSpecialist] = true;
+						}
+						iValue = aiSpecialistValues[eSpecialist];
+					}
+					else
+#endif
 #ifdef AUI_CITIZENS_UNHARDCODE_SPECIALIST_VALUE_HAPPINESS
 					iValue = GetSpecialistValue(eSpecialist, bIsWorked);
 #else
@@ -2094,6 +2116,14 @@ CvPlot* CvCityCitizens::GetBestCityPlotWithValue(int& iValue, bool bWantBest, bo
 
 	CvPlot* pLoopPlot;
 
+#ifdef AUI_CITIZENS_SHARED_SCAN_VALUES
+	// GetPlotValue() only looks at the plot's yields and whether it is worked (which is the same for every plot we look at here), so plots with identical yields get identical values
+	int aaiScannedYields[NUM_CITY_PLOTS][NUM_YIELD_TYPES];
+	int aiScannedValues[NUM_CITY_PLOTS];
+	int iNumScanned = 0;
+	int aiLoopYields[NUM_YIELD_TYPES];
+#endif
+
 	// Look at all workable Plots
 	for(int iPlotLoop = 0; iPlotLoop < NUM_CITY_PLOTS; iPlotLoop++)
 	{
@@ -2113,11 +2143,44 @@ CvPlot* CvCityCitizens::GetBestCityPlotWithValue(int& iValue, bool bWantBest, bo
 						// Working the Plot or CAN work the Plot?
 						if(bWantWorked || IsCanWork(pLoopPlot))
 						{
+#ifdef AUI_CITIZENS_SHARED_SCAN_VALUES
+							int iYieldLoop;
+							for (iYieldLoop = 0; iYieldLoop < NUM_YIELD_TYPES; iYieldLoop++)
+							{
+								aiLoopYields[iYieldLoop] = pLoopPlot->getYield((YieldTypes)iYieldLoop);
+							}
+							int iScannedLoop;
+							for (iScannedLoop = 0; iScannedLoop < iNumScanned; iScannedLoop++)
+							{
+								for (iYieldLoop = 0; iYieldLoop < NUM_YIELD_TYPES; iYieldLoop++)
+								{
+									if (aaiScannedYields[iScannedLoop][iYieldLoop] != aiLoopYields[iYieldLoop])
+										break;
+								}
+								if (iYieldLoop == NUM_YIELD_TYPES)
+									break;
+							}
+							if (iScannedLoop < iNumScanned)
+							{
+								iValue = aiScannedValues[iScannedLoop];
+							}
+							else
+							{
+#endif
 #ifdef AUI_CITIZENS_REALLOCATE_CITIZENS_USES_SELF_CONSISTENCY
 							iValue = GetPlotValue(pLoopPlot, true);
 #else
 							iValue = GetPlotValue(pLoopPlot, bWantBest);
 #endif
+#ifdef AUI_CITIZENS_SHARED_SCAN_VALUES
+								for (iYieldLoop = 0; iYieldLoop < NUM_YIELD_TYPES; iYieldLoop++)
+								{
+									aaiScannedYields[iNumScanned][iYieldLoop] = aiLoopYields[iYieldLoop];
+								}
+								aiScannedValues[iNumScanned] = iValue;
+								iNumScanned++;
+							}
+#endif
 
 							bPlotForceWorked = IsForcedWorkingPlot(pLoopPlot);
 
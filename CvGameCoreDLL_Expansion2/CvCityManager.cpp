@@ -10,12 +10,233 @@
 #include "CvCityManager.h"
 #include "CvGameCoreUtils.h"
 
+#ifdef AUI_CITY_MANAGER_GRID_INDEX
+// Cities are bucketed into square blocks of map cells, so a range query only has to look at the blocks overlapping its bounding box
+#define CITY_BUCKET_SIZE 8
+
+static std::vector<CvCityManager::CityList> ms_aBuckets;
+static int ms_iNumBucketsX = 0;
+static int ms_iNumBucketsY = 0;
+static uint ms_uiNumCities = 0;
+
+// Scratch list handed out by GetNearbyCities(), only valid until the next call
+static CvCityManager::CityList ms_kNearbyCities;
+#else
 typedef std::map<CvCity*, CvCityManager::CityList> CityMap;
 
 static CityMap ms_kCityMap;
+#endif
 
 static CvCityManager::CityList ms_kEmptyList;
 
+#ifdef AUI_CITY_MANAGER_GRID_INDEX
+//	---------------------------------------------------------------------------
+void CvCityManager::Reset()
+{
+	ms_aBuckets.clear();
+	ms_iNumBucketsX = 0;
+	ms_iNumBucketsY = 0;
+	ms_uiNumCities = 0;
+	ms_kNearbyCities.clear();
+}
+
+//	---------------------------------------------------------------------------
+void CvCityManager::Shutdown()
+{
+	Reset();
+}
+
+//	---------------------------------------------------------------------------
+static int GetCityBucketIndex(int iX, int iY)
+{
+	if (ms_aBuckets.empty())
+	{
+		// Map dimensions aren't known yet when Reset() is called, so the grid is sized on the first city
+		const CvMap& kMap = GC.getMap();
+		ms_iNumBucketsX = ((int)kMap.getGridWidth() + CITY_BUCKET_SIZE - 1) / CITY_BUCKET_SIZE;
+		ms_iNumBucketsY = ((int)kMap.getGridHeight() + CITY_BUCKET_SIZE - 1) / CITY_BUCKET_SIZE;
+		ms_aBuckets.resize(ms_iNumBucketsX * ms_iNumBucketsY);
+	}
+
+	return (iY / CITY_BUCKET_SIZE) * ms_iNumBucketsX + (iX / CITY_BUCKET_SIZE);
+}
+
+//	---------------------------------------------------------------------------
+void CvCityManager::OnCityCreated(CvCity* pkAddCity)
+{
+	int iBucket = GetCityBucketIndex(pkAddCity->getX(), pkAddCity->getY());
+	CityList& kBucket = ms_aBuckets[iBucket];
+	if (std::find(kBucket.begin(), kBucket.end(), pkAddCity) == kBucket.end())		// It should not be in there, but check anyhow
+	{
+		kBucket.push_back(pkAddCity);
+		ms_uiNumCities++;
+	}
+}
+
+//	---------------------------------------------------------------------------
+void CvCityManager::OnCityDestroyed(CvCity* pkCity)
+{
+	if (ms_aBuckets.empty())
+		return;
+
+	CityList& kBucket = ms_aBuckets[GetCityBucketIndex(pkCity->getX(), pkCity->getY())];
+	CityList::iterator itr = std::find(kBucket.begin(), kBucket.end(), pkCity);
+	if (itr != kBucket.end())
+	{
+		kBucket.erase(itr);
+		ms_uiNumCities--;
+	}
+}
+
+//	---------------------------------------------------------------------------
+// Marks the bucket rows or columns covering the cells iFrom..iTo (which may lie off the map on a wrapping axis)
+static void MarkBucketRange(int iFrom, int iTo, int iNumCells, bool bWrap, int iNumBuckets, std::vector<bool>& abBuckets)
+{
+	abBuckets.assign(iNumBuckets, false);
+	if (bWrap && iTo - iFrom + 1 >= iNumCells)
+	{
+		abBuckets.assign(iNumBuckets, true);
+		return;
+	}
+
+	for (int iCell = iFrom; iCell <= iTo; iCell++)
+	{
+		int iMapCell = iCell;
+		if (bWrap)
+		{
+			iMapCell = ((iCell % iNumCells) + iNumCells) % iNumCells;
+		}
+		else if (iCell < 0 || iCell >= iNumCells)
+		{
+			continue;
+		}
+		abBuckets[iMapCell / CITY_BUCKET_SIZE] = true;
+	}
+}
+
+//	---------------------------------------------------------------------------
+struct CityDistanceSort
+{
+	bool operator()(const std::pair<int, CvCity*>& lhs, const std::pair<int, CvCity*>& rhs) const
+	{
+		if (lhs.first != rhs.first)
+			return lhs.first < rhs.first;
+		// Ties are broken on owner and ID so results don't depend on bucket order
+		if (lhs.second->getOwner() != rhs.second->getOwner())
+			return lhs.second->getOwner() < rhs.second->getOwner();
+		return lhs.second->GetID() < rhs.second->GetID();
+	}
+};
+
+//	---------------------------------------------------------------------------
+void CvCityManager::GetCitiesWithinRange(int iX, int iY, int iRange, CityList& kCities)
+{
+	kCities.clear();
+	if (ms_aBuckets.empty() || ms_uiNumCities == 0 || iRange < 0)
+		return;
+
+	const CvMap& kMap = GC.getMap();
+	std::vector<bool> abColumns;
+	std::vector<bool> abRows;
+	MarkBucketRange(iX - iRange, iX + iRange, (int)kMap.getGridWidth(), kMap.isWrapX(), ms_iNumBucketsX, abColumns);
+	MarkBucketRange(iY - iRange, iY + iRange, (int)kMap.getGridHeight(), kMap.isWrapY(), ms_iNumBucketsY, abRows);
+
+	std::vector< std::pair<int, CvCity*> > aCandidates;
+	for (int iBucketY = 0; iBucketY < ms_iNumBucketsY; iBucketY++)
+	{
+		if (!abRows[iBucketY])
+			continue;
+
+		for (int iBucketX = 0; iBucketX < ms_iNumBucketsX; iBucketX++)
+		{
+			if (!abColumns[iBucketX])
+				continue;
+
+			const CityList& kBucket = ms_aBuckets[iBucketY * ms_iNumBucketsX + iBucketX];
+			for (CityList::const_iterator itr = kBucket.begin(); itr != kBucket.end(); ++itr)
+			{
+				int iDistance = plotDistance(iX, iY, (*itr)->getX(), (*itr)->getY());
+				if (iDistance <= iRange)
+				{
+					aCandidates.push_back(std::make_pair(iDistance, *itr));
+				}
+			}
+		}
+	}
+
+	std::sort(aCandidates.begin(), aCandidates.end(), CityDistanceSort());
+	kCities.reserve(aCandidates.size());
+	for (std::vector< std::pair<int, CvCity*> >::const_iterator itr = aCandidates.begin(); itr != aCandidates.end(); ++itr)
+	{
+		kCities.push_back(itr->second);
+	}
+}
+
+//	---------------------------------------------------------------------------
+void CvCityManager::GetNearestCities(int iX, int iY, uint uiCount, CityList& kCities)
+{
+	kCities.clear();
+	if (ms_aBuckets.empty() || uiCount == 0)
+		return;
+
+	const CvMap& kMap = GC.getMap();
+	int iMaxRange = (int)kMap.getGridWidth() + (int)kMap.getGridHeight();
+	if (uiCount >= ms_uiNumCities)
+	{
+		GetCitiesWithinRange(iX, iY, iMaxRange, kCities);
+		return;
+	}
+
+	// Widen the search one bucket at a time until it holds enough cities; everything within the searched range is closer than anything outside it
+	for (int iRange = CITY_BUCKET_SIZE; ; iRange += CITY_BUCKET_SIZE)
+	{
+		GetCitiesWithinRange(iX, iY, iRange, kCities);
+		if (kCities.size() >= uiCount || kCities.size() == ms_uiNumCities || iRange >= iMaxRange)
+			break;
+	}
+
+	if (kCities.size() > uiCount)
+	{
+		kCities.resize(uiCount);
+	}
+}
+
+//	---------------------------------------------------------------------------
+uint CvCityManager::GetNumCityBuckets()
+{
+	return ms_aBuckets.size();
+}
+
+//	---------------------------------------------------------------------------
+const CvCityManager::CityList& CvCityManager::GetCityBucket(uint uiBucket)
+{
+	CvAssert(uiBucket < ms_aBuckets.size());
+	if (uiBucket < ms_aBuckets.size())
+		return ms_aBuckets[uiBucket];
+
+	return ms_kEmptyList;
+}
+
+//	---------------------------------------------------------------------------
+const CvCityManager::CityList& CvCityManager::GetNearbyCities(CvCity* pkCity)
+{
+	CvAssert(pkCity);
+	if (pkCity)
+	{
+		GetNearestCities(pkCity->getX(), pkCity->getY(), ms_uiNumCities, ms_kNearbyCities);
+		CityList::iterator itr = std::find(ms_kNearbyCities.begin(), ms_kNearbyCities.end(), pkCity);
+		if (itr != ms_kNearbyCities.end())
+		{
+			ms_kNearbyCities.erase(itr);
+		}
+		return ms_kNearbyCities;
+	}
+
+	// This should not happen, but I wont' assume.
+	return ms_kEmptyList;
+}
+#else
+
 //	---------------------------------------------------------------------------
 void CvCityManager::Reset()
 {
@@ -139,3 +360,4 @@ const CvCityManager::CityList& CvCityManager::GetNearbyCities(CvCity* pkCity)
 	// This should not happen, but I wont' assume.
 	return ms_kEmptyList;
 }
+#endif
@@ -16,6 +16,15 @@ public:
 	typedef std::vector<CvCity*> CityList;
 	// Returns a list of nearby cities, sorted by distance, closest to furthest.
 	static const CityList& GetNearbyCities(CvCity* pkCity);
+#ifdef AUI_CITY_MANAGER_GRID_INDEX
+	// Fills kCities with every city within iRange plots of (iX, iY), sorted by distance, closest to furthest.
+	static void GetCitiesWithinRange(int iX, int iY, int iRange, CityList& kCities);
+	// Fills kCities with the (up to) uiCount cities closest to (iX, iY), sorted by distance, closest to furthest.
+	static void GetNearestCities(int iX, int iY, uint uiCount, CityList& kCities);
+	// The spatial index itself, for callers that visit every city and don't care about the order. Each bucket is a block of map cells.
+	static uint GetNumCityBuckets();
+	static const CityList& GetCityBucket(uint uiBucket);
+#endif
 };
 
 #endif // CVCITYMANAGER_H
\ No newline at end of file
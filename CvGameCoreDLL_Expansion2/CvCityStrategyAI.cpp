@@ -1395,7 +1395,11 @@ void CvCityStrategyAI::DoTurn()
 
 				// Check Lua hook
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if(pkScriptSystem && bStrategyShouldBeActive && LuaSupport::HasGameEventListeners("CityStrategyCanActivate"))
+#else
 				if(pkScriptSystem && bStrategyShouldBeActive)
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(iCityStrategiesLoop);
@@ -23,6 +23,13 @@
 
 REMARK_GROUP("CvDangerPlots");
 
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+// Relationship signatures that mean no danger is taken from the player at all
+static const int DANGER_SIGNATURE_UNKNOWN = MIN_INT;
+static const int DANGER_SIGNATURE_DEAD = -1;
+static const int DANGER_SIGNATURE_IGNORED = -2;
+#endif
+
 /// Constructor
 CvDangerPlots::CvDangerPlots(void)
 	: m_ePlayer(NO_PLAYER)
@@ -32,6 +39,11 @@ CvDangerPlots::CvDangerPlots(void)
 	, m_bArrayAllocated(false)
 #endif
 	, m_bDirty(false)
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	, m_pRecordingFootprint(NULL)
+	, m_uiUpdateCount(0)
+	, m_bFullRebuildNeeded(true)
+#endif
 {
 	m_fMajorWarMod = GC.getAI_DANGER_MAJOR_APPROACH_WAR();
 	m_fMajorHostileMod = GC.getAI_DANGER_MAJOR_APPROACH_HOSTILE();
@@ -72,6 +84,9 @@ void CvDangerPlots::Init(PlayerTypes ePlayer, bool bAllocate)
 		{
 			m_DangerPlots[i] = 0;
 		}
+#endif
+#if defined(AUI_DANGER_PLOTS_INCREMENTAL_UPDATE) && defined(AUI_DANGER_PLOTS_FIX_ADD_DANGER_WITHIN_ONE_MOVE)
+		m_aiWithinOneMoveCount.assign(iGridSize, 0);
 #endif
 	}
 }
@@ -88,6 +103,12 @@ void CvDangerPlots::Uninit()
 	m_bArrayAllocated = false;
 #endif
 	m_bDirty = false;
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	SetFullRebuildNeeded();
+#ifdef AUI_DANGER_PLOTS_FIX_ADD_DANGER_WITHIN_ONE_MOVE
+	m_aiWithinOneMoveCount.clear();
+#endif
+#endif
 }
 
 /// Updates the danger plots values to reflect threats across the map
@@ -103,7 +124,25 @@ void CvDangerPlots::UpdateDanger(bool bPretendWarWithAllCivs, bool bIgnoreVisibi
 		return;
 	}
 
+#ifdef AUI_ASTAR_REACHABILITY_MEMO
+	// Paths that don't ignore units are costed with danger
+	InvalidateReachabilityMemo();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	if(!bPretendWarWithAllCivs && !bIgnoreVisibility)
+	{
+		UpdateDangerIncremental();
+		return;
+	}
+	// The stored footprints don't match what is about to be computed, so the next regular update has to start over
+	SetFullRebuildNeeded();
+#endif
+
 	// wipe out values
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	CvAssertMsg((int)GC.getMap().numPlots() == m_DangerPlots.size(), "iGridSize does not match number of DangerPlots");
+	WipeDanger();
+#else
 	int iGridSize = GC.getMap().numPlots();
 	CvAssertMsg(iGridSize == m_DangerPlots.size(), "iGridSize does not match number of DangerPlots");
 #ifdef AUI_DANGER_PLOTS_FIX_USE_ARRAY_NOT_FFASTVECTOR
@@ -113,6 +152,7 @@ void CvDangerPlots::UpdateDanger(bool bPretendWarWithAllCivs, bool bIgnoreVisibi
 	{
 		m_DangerPlots[i] = 0;
 	}
+#endif
 #endif
 
 	CvPlayer& thisPlayer = GET_PLAYER(m_ePlayer);
@@ -156,6 +196,9 @@ void CvDangerPlots::UpdateDanger(bool bPretendWarWithAllCivs, bool bIgnoreVisibi
 				iRange += pLoopUnit->GetRange();
 			}
 
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+			AssignUnitDangerArea(pLoopUnit, iRange);
+#else
 			CvPlot* pUnitPlot = pLoopUnit->plot();
 			AssignUnitDangerValue(pLoopUnit, pUnitPlot);
 			CvPlot* pLoopPlot = NULL;
@@ -188,6 +231,7 @@ void CvDangerPlots::UpdateDanger(bool bPretendWarWithAllCivs, bool bIgnoreVisibi
 					AssignUnitDangerValue(pLoopUnit, pLoopPlot);
 				}
 			}
+#endif
 		}
 
 		// for each city
@@ -199,6 +243,9 @@ void CvDangerPlots::UpdateDanger(bool bPretendWarWithAllCivs, bool bIgnoreVisibi
 				continue;
 			}
 
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+			AssignCityDangerArea(pLoopCity);
+#else
 			int iRange = GC.getCITY_ATTACK_RANGE();
 			CvPlot* pCityPlot = pLoopCity->plot();
 			AssignCityDangerValue(pLoopCity, pCityPlot);
@@ -228,10 +275,14 @@ void CvDangerPlots::UpdateDanger(bool bPretendWarWithAllCivs, bool bIgnoreVisibi
 					AssignCityDangerValue(pLoopCity, pLoopPlot);
 				}
 			}
+#endif
 		}
 	}
 
 	// Citadels
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	AssignCitadelDanger(bIgnoreVisibility);
+#else
 	int iCitadelValue = GetDangerValueOfCitadel();
 #ifdef AUI_WARNING_FIXES
 	uint iPlotLoop;
@@ -263,6 +314,7 @@ void CvDangerPlots::UpdateDanger(bool bPretendWarWithAllCivs, bool bIgnoreVisibi
 			}
 		}
 	}
+#endif
 
 	// testing city danger values
 	CvCity* pLoopCity;
@@ -276,6 +328,367 @@ void CvDangerPlots::UpdateDanger(bool bPretendWarWithAllCivs, bool bIgnoreVisibi
 	m_bDirty = false;
 }
 
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+//	-----------------------------------------------------------------------------------------------
+/// Brings the danger plots up to date by only recomputing the contributions of units whose surroundings changed
+void CvDangerPlots::UpdateDangerIncremental()
+{
+	CvPlayer& thisPlayer = GET_PLAYER(m_ePlayer);
+	TeamTypes thisTeam = thisPlayer.getTeam();
+
+	if(m_bFullRebuildNeeded)
+	{
+		WipeDanger();
+		m_UnitFootprints.clear();
+		m_aStaticFootprint.clear();
+		for(int iI = 0; iI < MAX_PLAYERS; iI++)
+		{
+			m_aiRelationshipSignature[iI] = DANGER_SIGNATURE_UNKNOWN;
+		}
+		m_bFullRebuildNeeded = false;
+	}
+	else
+	{
+		RemoveDanger(m_aStaticFootprint);
+		m_aStaticFootprint.clear();
+	}
+	m_uiUpdateCount++;
+
+	// for each opposing civ
+	for(int iPlayer = 0; iPlayer < MAX_PLAYERS; iPlayer++)
+	{
+		PlayerTypes ePlayer = (PlayerTypes)iPlayer;
+		CvPlayer& loopPlayer = GET_PLAYER(ePlayer);
+
+		if(loopPlayer.getTeam() == thisTeam)
+		{
+			continue;
+		}
+
+		// A different relationship changes the value of every plot this player's units threaten
+		int iSignature = GetRelationshipSignature(ePlayer);
+		if(iSignature != m_aiRelationshipSignature[iPlayer])
+		{
+			CvUnitDangerFootprintMap::iterator it = m_UnitFootprints.begin();
+			while(it != m_UnitFootprints.end())
+			{
+				if(it->first.first == ePlayer)
+				{
+					RemoveDanger(it->second.m_aEntries);
+					m_UnitFootprints.erase(it++);
+				}
+				else
+				{
+					++it;
+				}
+			}
+			m_aiRelationshipSignature[iPlayer] = iSignature;
+		}
+
+		if(iSignature == DANGER_SIGNATURE_DEAD || iSignature == DANGER_SIGNATURE_IGNORED)
+		{
+			continue;
+		}
+
+		//for each unit
+		int iLoop;
+		CvUnit* pLoopUnit = NULL;
+		for(pLoopUnit = loopPlayer.firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = loopPlayer.nextUnit(&iLoop))
+		{
+			if(ShouldIgnoreUnit(pLoopUnit))
+			{
+				continue;
+			}
+
+			int iRange = pLoopUnit->baseMoves();
+			if(pLoopUnit->canRangeStrike())
+			{
+				iRange += pLoopUnit->GetRange();
+			}
+
+			std::pair<PlayerTypes, int> kKey(ePlayer, pLoopUnit->GetID());
+			CvUnitDangerFootprintMap::iterator it = m_UnitFootprints.find(kKey);
+			if(it != m_UnitFootprints.end())
+			{
+				if(IsFootprintCurrent(it->second, pLoopUnit, iRange))
+				{
+					it->second.m_uiLastSeenUpdate = m_uiUpdateCount;
+					continue;
+				}
+				RemoveDanger(it->second.m_aEntries);
+				it->second.m_aEntries.clear();
+			}
+			else
+			{
+				it = m_UnitFootprints.insert(std::make_pair(kKey, CvUnitDangerFootprint())).first;
+			}
+
+			CvUnitDangerFootprint& kFootprint = it->second;
+			kFootprint.m_iPlotIndex = (int)pLoopUnit->plot()->GetPlotIndex();
+			kFootprint.m_eUnitType = pLoopUnit->getUnitType();
+			kFootprint.m_iCombatStrength = pLoopUnit->GetBaseCombatStrengthConsideringDamage();
+			kFootprint.m_iMovesLeft = pLoopUnit->movesLeft();
+			kFootprint.m_iRange = iRange;
+			kFootprint.m_bEmbarked = pLoopUnit->isEmbarked();
+			kFootprint.m_uiPlotChangeStamp = GC.getMap().GetPlotChangeStamp();
+			kFootprint.m_uiPathCostStamp = GC.getMap().GetPathCostStamp();
+			kFootprint.m_uiLastSeenUpdate = m_uiUpdateCount;
+
+			m_pRecordingFootprint = &kFootprint.m_aEntries;
+			AssignUnitDangerArea(pLoopUnit, iRange);
+			m_pRecordingFootprint = NULL;
+		}
+
+		// for each city
+		m_pRecordingFootprint = &m_aStaticFootprint;
+		CvCity* pLoopCity;
+		for(pLoopCity = loopPlayer.firstCity(&iLoop); pLoopCity != NULL; pLoopCity = loopPlayer.nextCity(&iLoop))
+		{
+			if(ShouldIgnoreCity(pLoopCity))
+			{
+				continue;
+			}
+
+			AssignCityDangerArea(pLoopCity);
+		}
+		m_pRecordingFootprint = NULL;
+	}
+
+	// Units that died or can no longer be seen take their danger with them
+	CvUnitDangerFootprintMap::iterator it = m_UnitFootprints.begin();
+	while(it != m_UnitFootprints.end())
+	{
+		if(it->second.m_uiLastSeenUpdate != m_uiUpdateCount)
+		{
+			RemoveDanger(it->second.m_aEntries);
+			m_UnitFootprints.erase(it++);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	// Citadels
+	m_pRecordingFootprint = &m_aStaticFootprint;
+	AssignCitadelDanger(false);
+	m_pRecordingFootprint = NULL;
+
+	// testing city danger values
+	CvCity* pLoopCity;
+	int iLoopCity = 0;
+	for(pLoopCity = thisPlayer.firstCity(&iLoopCity); pLoopCity != NULL; pLoopCity = thisPlayer.nextCity(&iLoopCity))
+	{
+		int iThreatValue = GetCityDanger(pLoopCity);
+		pLoopCity->SetThreatValue(iThreatValue);
+	}
+
+	m_bDirty = false;
+}
+
+/// Zeroes out every danger value
+void CvDangerPlots::WipeDanger()
+{
+	int iGridSize = GC.getMap().numPlots();
+#ifdef AUI_DANGER_PLOTS_FIX_USE_ARRAY_NOT_FFASTVECTOR
+	fill(m_DangerPlots, m_DangerPlots + iGridSize, 0);
+#else
+	for(int i = 0; i < iGridSize; i++)
+	{
+		m_DangerPlots[i] = 0;
+	}
+#endif
+#ifdef AUI_DANGER_PLOTS_FIX_ADD_DANGER_WITHIN_ONE_MOVE
+	m_aiWithinOneMoveCount.assign(iGridSize, 0);
+#endif
+}
+
+/// Takes back danger that was previously added through AddDanger()
+void CvDangerPlots::RemoveDanger(const CvDangerFootprintEntries& aEntries)
+{
+	for(CvDangerFootprintEntries::const_iterator it = aEntries.begin(); it != aEntries.end(); ++it)
+	{
+		m_DangerPlots[it->m_iPlotIndex] -= it->m_iValue;
+#ifdef AUI_DANGER_PLOTS_FIX_ADD_DANGER_WITHIN_ONE_MOVE
+		if(it->m_bWithinOneMove && --m_aiWithinOneMoveCount[it->m_iPlotIndex] <= 0)
+		{
+			m_aiWithinOneMoveCount[it->m_iPlotIndex] = 0;
+			m_DangerPlots[it->m_iPlotIndex] &= ~0x1;
+		}
+#endif
+	}
+}
+
+/// Condenses everything ModifyDangerByRelationship() and IsDangerByRelationshipZero() look at for a player into one value
+int CvDangerPlots::GetRelationshipSignature(PlayerTypes ePlayer)
+{
+	CvPlayer& kThisPlayer = GET_PLAYER(m_ePlayer);
+	CvPlayer& kPlayer = GET_PLAYER(ePlayer);
+
+	if(!kPlayer.isAlive())
+	{
+		return DANGER_SIGNATURE_DEAD;
+	}
+	if(ShouldIgnorePlayer(ePlayer))
+	{
+		return DANGER_SIGNATURE_IGNORED;
+	}
+	if(GET_TEAM(kThisPlayer.getTeam()).isAtWar(kPlayer.getTeam()))
+	{
+		return -3;
+	}
+	if(kThisPlayer.isHuman())
+	{
+		return -4;
+	}
+	if(kThisPlayer.isMinorCiv())
+	{
+		return -5;
+	}
+	if(!kPlayer.isMinorCiv())
+	{
+		return (int)kThisPlayer.GetDiplomacyAI()->GetMajorCivApproach(ePlayer, /*bHideTrueFeelings*/ false);
+	}
+	return NUM_MAJOR_CIV_APPROACHES + (int)kThisPlayer.GetDiplomacyAI()->GetMinorCivApproach(ePlayer);
+}
+
+/// Can the danger a unit added last time be reused as is?
+bool CvDangerPlots::IsFootprintCurrent(const CvUnitDangerFootprint& kFootprint, CvUnit* pUnit, int iRange) const
+{
+	CvPlot* pUnitPlot = pUnit->plot();
+	if(kFootprint.m_iPlotIndex != (int)pUnitPlot->GetPlotIndex() || kFootprint.m_eUnitType != pUnit->getUnitType() || kFootprint.m_iRange != iRange ||
+		kFootprint.m_iCombatStrength != pUnit->GetBaseCombatStrengthConsideringDamage() || kFootprint.m_iMovesLeft != pUnit->movesLeft() ||
+		kFootprint.m_bEmbarked != pUnit->isEmbarked())
+	{
+		return false;
+	}
+
+	// Turns to reach each plot come from an unbounded path search, so a new road, improvement or border anywhere can change them
+	if(kFootprint.m_uiPathCostStamp != GC.getMap().GetPathCostStamp())
+	{
+		return false;
+	}
+
+	// Whether the unit can attack into or strike a plot depends on the plots in and just past its range, so any other change there counts too
+	const int iCheckRange = iRange + 1;
+	for(int iDX = -iCheckRange; iDX <= iCheckRange; iDX++)
+	{
+		for(int iDY = -iCheckRange; iDY <= iCheckRange; iDY++)
+		{
+			CvPlot* pLoopPlot = plotXYWithRangeCheck(pUnitPlot->getX(), pUnitPlot->getY(), iDX, iDY, iCheckRange);
+			if(pLoopPlot && pLoopPlot->GetChangeStamp() > kFootprint.m_uiPlotChangeStamp)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/// Adds the danger of a unit to every plot it can reach or strike this turn (shared by the full and incremental updates)
+void CvDangerPlots::AssignUnitDangerArea(CvUnit* pUnit, int iRange)
+{
+	CvPlot* pUnitPlot = pUnit->plot();
+	AssignUnitDangerValue(pUnit, pUnitPlot);
+	CvPlot* pLoopPlot = NULL;
+
+#ifdef AUI_HEXSPACE_DX_LOOPS
+	for (int iDY = -iRange; iDY <= iRange; iDY++)
+	{
+		int iMaxDX = iRange - MAX(0, iDY);
+		for (int iDX = -iRange - MIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+		{
+			// No need for range check because loops are set up properly
+			pLoopPlot = plotXY(pUnitPlot->getX(), pUnitPlot->getY(), iDX, iDY);
+#else
+	for(int iDX = -(iRange); iDX <= iRange; iDX++)
+	{
+		for(int iDY = -(iRange); iDY <= iRange; iDY++)
+		{
+			pLoopPlot = plotXYWithRangeCheck(pUnitPlot->getX(), pUnitPlot->getY(), iDX, iDY, iRange);
+#endif
+			if(!pLoopPlot || pLoopPlot == pUnitPlot)
+			{
+				continue;
+			}
+
+			if(!pUnit->canMoveOrAttackInto(*pLoopPlot) && !pUnit->canRangeStrikeAt(pLoopPlot->getX(),pLoopPlot->getY()))
+			{
+				continue;
+			}
+
+			AssignUnitDangerValue(pUnit, pLoopPlot);
+		}
+	}
+}
+
+/// Adds the danger of a city to every plot it can bombard
+void CvDangerPlots::AssignCityDangerArea(CvCity* pCity)
+{
+	int iRange = GC.getCITY_ATTACK_RANGE();
+	CvPlot* pCityPlot = pCity->plot();
+	AssignCityDangerValue(pCity, pCityPlot);
+	CvPlot* pLoopPlot = NULL;
+
+#ifdef AUI_HEXSPACE_DX_LOOPS
+	for (int iDY = -iRange; iDY <= iRange; iDY++)
+	{
+		int iMaxDX = iRange - MAX(0, iDY);
+		for (int iDX = -iRange - MIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+		{
+			// No need for range check because loops are set up properly
+			pLoopPlot = plotXY(pCityPlot->getX(), pCityPlot->getY(), iDX, iDY);
+#else
+	for(int iDX = -(iRange); iDX <= iRange; iDX++)
+	{
+		for(int iDY = -(iRange); iDY <= iRange; iDY++)
+		{
+			pLoopPlot = plotXYWithRangeCheck(pCityPlot->getX(), pCityPlot->getY(), iDX, iDY, iRange);
+#endif
+			if(!pLoopPlot)
+			{
+				continue;
+			}
+
+			AssignCityDangerValue(pCity, pLoopPlot);
+		}
+	}
+}
+
+/// Adds the danger of enemy citadels to the plots next to them
+void CvDangerPlots::AssignCitadelDanger(bool bIgnoreVisibility)
+{
+	TeamTypes thisTeam = GET_PLAYER(m_ePlayer).getTeam();
+	int iCitadelValue = GetDangerValueOfCitadel();
+	CvPlot* pPlot, *pAdjacentPlot;
+	for(int iPlotLoop = 0; iPlotLoop < GC.getMap().numPlots(); iPlotLoop++)
+	{
+		pPlot = GC.getMap().plotByIndexUnchecked(iPlotLoop);
+
+		if(pPlot->isRevealed(thisTeam))
+		{
+			ImprovementTypes eImprovement = pPlot->getRevealedImprovementType(thisTeam);
+			if(eImprovement != NO_IMPROVEMENT && GC.getImprovementInfo(eImprovement)->GetNearbyEnemyDamage() > 0)
+			{
+				if(!ShouldIgnoreCitadel(pPlot, bIgnoreVisibility))
+				{
+					for(int iI = 0; iI < NUM_DIRECTION_TYPES; iI++)
+					{
+						pAdjacentPlot = plotDirection(pPlot->getX(), pPlot->getY(), ((DirectionTypes)iI));
+
+						if(pAdjacentPlot != NULL)
+						{
+							AddDanger(pAdjacentPlot->getX(), pAdjacentPlot->getY(), iCitadelValue, true);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+#endif
+
 /// Add an amount of danger to a given tile
 void CvDangerPlots::AddDanger(int iPlotX, int iPlotY, int iValue, bool bWithinOneMove)
 {
@@ -301,6 +714,23 @@ void CvDangerPlots::AddDanger(int iPlotX, int iPlotY, int iValue, bool bWithinOn
 	if (bWithinOneMove)
 	{
 		m_DangerPlots[idx] |= 0x1;
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		if (!m_aiWithinOneMoveCount.empty())
+		{
+			m_aiWithinOneMoveCount[idx]++;
+		}
+#endif
+	}
+#endif
+
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	if (m_pRecordingFootprint && (iValue != 0 || bWithinOneMove))
+	{
+		CvDangerFootprintEntry kEntry;
+		kEntry.m_iPlotIndex = idx;
+		kEntry.m_iValue = iValue;
+		kEntry.m_bWithinOneMove = bWithinOneMove;
+		m_pRecordingFootprint->push_back(kEntry);
 	}
 #endif
 }
@@ -806,6 +1236,9 @@ void CvDangerPlots::Read(FDataStream& kStream)
 #endif
 
 	m_bDirty = false;
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	SetFullRebuildNeeded();
+#endif
 }
 
 /// writes out danger plots info
@@ -852,3 +1285,40 @@ void CvDangerPlots::SetDirty()
 {
 	m_bDirty = true;
 }
+
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+//	-----------------------------------------------------------------------------------------------
+/// Something changed that footprints can't detect on their own (eg. war between two other teams), so throw them all out
+void CvDangerPlots::SetFullRebuildNeeded()
+{
+	m_bFullRebuildNeeded = true;
+	m_UnitFootprints.clear();
+	m_aStaticFootprint.clear();
+	m_pRecordingFootprint = NULL;
+}
+
+//	-----------------------------------------------------------------------------------------------
+/// The unit's reach changed without it moving (eg. a promotion), so its danger is recomputed on the next update
+void CvDangerPlots::InvalidateUnitFootprint(PlayerTypes eUnitOwner, int iUnitID)
+{
+	CvUnitDangerFootprintMap::iterator it = m_UnitFootprints.find(std::make_pair(eUnitOwner, iUnitID));
+	if(it != m_UnitFootprints.end())
+	{
+		// No unit stands on plot -1, so IsFootprintCurrent() fails and the old danger is taken back before the new one is added
+		it->second.m_iPlotIndex = -1;
+	}
+}
+
+//	-----------------------------------------------------------------------------------------------
+/// Same as InvalidateUnitFootprint(), for every unit owned by a member of eTeam (eg. after a tech changed where they can move)
+void CvDangerPlots::InvalidateTeamUnitFootprints(TeamTypes eTeam)
+{
+	for(CvUnitDangerFootprintMap::iterator it = m_UnitFootprints.begin(); it != m_UnitFootprints.end(); ++it)
+	{
+		if(GET_PLAYER(it->first.first).getTeam() == eTeam)
+		{
+			it->second.m_iPlotIndex = -1;
+		}
+	}
+}
+#endif
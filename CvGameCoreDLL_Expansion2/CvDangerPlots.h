@@ -12,6 +12,33 @@
 
 #include "CvDiplomacyAIEnums.h"
 
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+// One plot's worth of danger added by a single source (unit, city or citadel)
+struct CvDangerFootprintEntry
+{
+	int m_iPlotIndex;
+	int m_iValue;
+	bool m_bWithinOneMove;
+};
+typedef std::vector<CvDangerFootprintEntry> CvDangerFootprintEntries;
+
+// Everything a unit's danger contribution was computed from, so it can be reused while none of it changes
+struct CvUnitDangerFootprint
+{
+	int m_iPlotIndex;
+	UnitTypes m_eUnitType;
+	int m_iCombatStrength;
+	int m_iMovesLeft;
+	int m_iRange;
+	bool m_bEmbarked;
+	uint m_uiPlotChangeStamp;
+	uint m_uiPathCostStamp;
+	uint m_uiLastSeenUpdate;
+	CvDangerFootprintEntries m_aEntries;
+};
+typedef std::map< std::pair<PlayerTypes, int>, CvUnitDangerFootprint > CvUnitDangerFootprintMap;
+#endif
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  CLASS:      CvDangerPlots
 //!  \brief		Used to calculate the relative danger of a given plot for a player
@@ -56,6 +83,11 @@ public:
 	{
 		return m_bDirty;
 	}
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	void SetFullRebuildNeeded();
+	void InvalidateUnitFootprint(PlayerTypes eUnitOwner, int iUnitID);
+	void InvalidateTeamUnitFootprints(TeamTypes eTeam);
+#endif
 
 	void Read(FDataStream& kStream);
 	void Write(FDataStream& kStream) const;
@@ -66,6 +98,17 @@ protected:
 
 	int GetDangerValueOfCitadel() const;
 
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	void UpdateDangerIncremental();
+	void WipeDanger();
+	void RemoveDanger(const CvDangerFootprintEntries& aEntries);
+	int GetRelationshipSignature(PlayerTypes ePlayer);
+	bool IsFootprintCurrent(const CvUnitDangerFootprint& kFootprint, CvUnit* pUnit, int iRange) const;
+	void AssignUnitDangerArea(CvUnit* pUnit, int iRange);
+	void AssignCityDangerArea(CvCity* pCity);
+	void AssignCitadelDanger(bool bIgnoreVisibility);
+#endif
+
 	PlayerTypes m_ePlayer;
 #ifndef AUI_DANGER_PLOTS_FIX_USE_ARRAY_NOT_FFASTVECTOR
 	bool m_bArrayAllocated;
@@ -88,6 +131,19 @@ protected:
 #else
 	FFastVector<uint, true, c_eCiv5GameplayDLL, 0> m_DangerPlots;
 #endif
+
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	// None of this is serialized, the first update after loading does a full rebuild
+	CvUnitDangerFootprintMap m_UnitFootprints;
+	CvDangerFootprintEntries m_aStaticFootprint; // cities and citadels, rebuilt on every update
+	CvDangerFootprintEntries* m_pRecordingFootprint;
+#ifdef AUI_DANGER_PLOTS_FIX_ADD_DANGER_WITHIN_ONE_MOVE
+	std::vector<int> m_aiWithinOneMoveCount;
+#endif
+	int m_aiRelationshipSignature[MAX_PLAYERS];
+	uint m_uiUpdateCount;
+	bool m_bFullRebuildNeeded;
+#endif
 };
 
 #endif //CIV5_PROJECT_CLASSES_H
\ No newline at end of file
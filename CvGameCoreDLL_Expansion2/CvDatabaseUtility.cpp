@@ -32,6 +32,9 @@ void CvDatabaseUtility::ClearResults()
 	}
 
 	m_storedResults.clear();
+#ifdef AUI_DATABASE_UTILITY_CACHED_MAX_ROWS
+	m_cachedMaxRows.clear();
+#endif
 }
 //------------------------------------------------------------------------------
 void CvDatabaseUtility::ClearResults(const std::string& strKey)
@@ -324,6 +327,17 @@ bool CvDatabaseUtility::SetYields(int*& pYieldsArray,
 //------------------------------------------------------------------------------
 int CvDatabaseUtility::MaxRows(const char* szTableName)
 {
+#ifdef AUI_DATABASE_UTILITY_CACHED_MAX_ROWS
+	// Every PopulateArray* call sizes its array with this, so a single CacheResults() pass would otherwise compile the same statement dozens of times
+	// Tables aren't modified while a utility instance is alive (they only live for one prefetch/cache pass), so the first answer stays valid
+	std::string strTableName(szTableName);
+	MaxRowsMap::const_iterator it = m_cachedMaxRows.find(strTableName);
+	if(it != m_cachedMaxRows.end())
+	{
+		return it->second;
+	}
+
+#endif
 	char szSQL[256] = {0};
 	sprintf_s(szSQL, "SELECT max(rowid) from %s", szTableName);
 	Database::Results kResults;
@@ -337,6 +351,9 @@ int CvDatabaseUtility::MaxRows(const char* szTableName)
 		}
 	}
 
+#ifdef AUI_DATABASE_UTILITY_CACHED_MAX_ROWS
+	m_cachedMaxRows[strTableName] = maxValue;
+#endif
 	return maxValue;
 }
 //------------------------------------------------------------------------------
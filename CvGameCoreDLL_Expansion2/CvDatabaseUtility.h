@@ -111,6 +111,10 @@ void InitializeArray(T*& pArray, const char* szTableName, T default = (T)0);
 private:
 	typedef stdext::hash_map<std::string, Database::Results*> ResultsMap;
 	ResultsMap m_storedResults;
+#ifdef AUI_DATABASE_UTILITY_CACHED_MAX_ROWS
+	typedef stdext::hash_map<std::string, int> MaxRowsMap;
+	MaxRowsMap m_cachedMaxRows;
+#endif
 };
 
 //------------------------------------------------------------------------------
@@ -54,6 +54,26 @@ void CvDealAI::Reset()
 	m_iCachedValueOfPeaceWithHuman = 0;
 }
 
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+/// Fold the value of an item that was just added to a deal into its running totals, exactly as GetDealValue() would count it
+void CvDealAI::AddItemValueToDealValue(int iItemValue, bool bFromMe, int& iTotalValue, int& iValueImOffering, int& iValueTheyreOffering) const
+{
+	// Multiplier is -1 if we're giving something away, 1 if we're receiving something
+	if (bFromMe)
+		iItemValue = -iItemValue;
+
+	iTotalValue += iItemValue;
+	if (iItemValue < 0)
+	{
+		iValueImOffering -= iItemValue;
+	}
+	else
+	{
+		iValueTheyreOffering += iItemValue;
+	}
+}
+#endif
+
 /// Serialization read
 void CvDealAI::Read(FDataStream& kStream)
 {
@@ -2423,8 +2443,16 @@ void CvDealAI::DoAddVoteCommitmentToThem(CvDeal* pDeal, PlayerTypes eThem, bool
 						// If adding this to the deal doesn't take it over the limit, do it
 						if(iItemValue + iTotalValue <= iAmountOverWeWillRequest)
 						{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 							pDeal->AddVoteCommitment(eThem, iProposalID, iVoteChoice, iNumVotes, bRepeal);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							if (pDeal->m_TradedItems.size() > uiNumItems)
+								AddItemValueToDealValue(iItemValue, /*bFromMe*/ false, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 							iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 						}
 					}
 				}
@@ -2464,8 +2492,16 @@ void CvDealAI::DoAddVoteCommitmentToUs(CvDeal* pDeal, PlayerTypes eThem, bool bD
 						// If adding this to the deal doesn't take it under the min limit, do it
 						if(-iItemValue + iTotalValue >= iAmountUnderWeWillOffer)
 						{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 							pDeal->AddVoteCommitment(eMyPlayer, iProposalID, iVoteChoice, iNumVotes, bRepeal);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							if (pDeal->m_TradedItems.size() > uiNumItems)
+								AddItemValueToDealValue(iItemValue, /*bFromMe*/ true, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 							iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 						}
 					}
 				}
@@ -2530,8 +2566,16 @@ void CvDealAI::DoAddResourceToThem(CvDeal* pDeal, PlayerTypes eThem, bool bDontC
 						// Try to change the current item if it already exists, otherwise add it
 						if(!pDeal->ChangeResourceTrade(eThem, eResource, iResourceQuantity, iDealDuration))
 						{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 							pDeal->AddResourceTrade(eThem, eResource, iResourceQuantity, iDealDuration);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							if (pDeal->m_TradedItems.size() > uiNumItems)
+								AddItemValueToDealValue(iItemValue, /*bFromMe*/ false, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 							iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 						}
 					}
 				}
@@ -2566,8 +2610,16 @@ void CvDealAI::DoAddResourceToThem(CvDeal* pDeal, PlayerTypes eThem, bool bDontC
 						// Try to change the current item if it already exists, otherwise add it
 						if(!pDeal->ChangeResourceTrade(eThem, eResource, iResourceQuantity, iDealDuration))
 						{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 							pDeal->AddResourceTrade(eThem, eResource, iResourceQuantity, iDealDuration);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							if (pDeal->m_TradedItems.size() > uiNumItems)
+								AddItemValueToDealValue(iItemValue, /*bFromMe*/ false, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 							iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 						}
 					}
 				}
@@ -2637,8 +2689,16 @@ void CvDealAI::DoAddResourceToUs(CvDeal* pDeal, PlayerTypes eThem, bool bDontCha
 						// Try to change the current item if it already exists, otherwise add it
 						if(!pDeal->ChangeResourceTrade(eMyPlayer, eResource, iResourceQuantity, iDealDuration))
 						{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 							pDeal->AddResourceTrade(eMyPlayer, eResource, iResourceQuantity, iDealDuration);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+							if (pDeal->m_TradedItems.size() > uiNumItems)
+								AddItemValueToDealValue(iItemValue, /*bFromMe*/ true, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 							iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 						}
 					}
 				}
@@ -2671,8 +2731,16 @@ void CvDealAI::DoAddEmbassyToThem(CvDeal* pDeal, PlayerTypes eThem, bool bDontCh
 					// If adding this to the deal doesn't take it over the limit, do it
 					if(iItemValue + iTotalValue <= iAmountOverWeWillRequest)
 					{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+						const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 						pDeal->AddAllowEmbassy(eThem);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+						if (pDeal->m_TradedItems.size() > uiNumItems)
+							AddItemValueToDealValue(iItemValue, /*bFromMe*/ false, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 						iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 					}
 				}
 			}
@@ -2703,8 +2771,16 @@ void CvDealAI::DoAddEmbassyToUs(CvDeal* pDeal, PlayerTypes eThem, bool bDontChan
 					// If adding this to the deal doesn't take it under the min limit, do it
 					if(-iItemValue + iTotalValue >= iAmountUnderWeWillOffer)
 					{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+						const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 						pDeal->AddAllowEmbassy(eMyPlayer);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+						if (pDeal->m_TradedItems.size() > uiNumItems)
+							AddItemValueToDealValue(iItemValue, /*bFromMe*/ true, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 						iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 					}
 				}
 			}
@@ -2735,8 +2811,16 @@ void CvDealAI::DoAddOpenBordersToThem(CvDeal* pDeal, PlayerTypes eThem, bool bDo
 					// If adding this to the deal doesn't take it over the limit, do it
 					if(iItemValue + iTotalValue <= iAmountOverWeWillRequest)
 					{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+						const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 						pDeal->AddOpenBorders(eThem, iDealDuration);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+						if (pDeal->m_TradedItems.size() > uiNumItems)
+							AddItemValueToDealValue(iItemValue, /*bFromMe*/ false, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 						iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 					}
 				}
 			}
@@ -2767,8 +2851,16 @@ void CvDealAI::DoAddOpenBordersToUs(CvDeal* pDeal, PlayerTypes eThem, bool bDont
 					// If adding this to the deal doesn't take it under the min limit, do it
 					if(-iItemValue + iTotalValue >= iAmountUnderWeWillOffer)
 					{
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+						const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 						pDeal->AddOpenBorders(eMyPlayer, iDealDuration);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+						if (pDeal->m_TradedItems.size() > uiNumItems)
+							AddItemValueToDealValue(iItemValue, /*bFromMe*/ true, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 						iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 					}
 				}
 			}
@@ -2867,8 +2959,16 @@ void CvDealAI::DoAddCitiesToUs(CvDeal* pDeal, PlayerTypes eThem, bool bDontChang
 			if(-iItemValue + iTotalValue >= iAmountUnderWeWillOffer)
 			{
 				//pDeal->AddOpenBorders(eMyPlayer, iDealDuration);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+				const uint uiNumItems = pDeal->m_TradedItems.size();
+#endif
 				pDeal->AddCityTrade(eMyPlayer, iSortedCityID);
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+				if (pDeal->m_TradedItems.size() > uiNumItems)
+					AddItemValueToDealValue(iItemValue, /*bFromMe*/ true, iTotalValue, iValueImOffering, iValueTheyreOffering);
+#else
 				iTotalValue = GetDealValue(pDeal, iValueImOffering, iValueTheyreOffering, bUseEvenValue);
+#endif
 			}
 		}
 
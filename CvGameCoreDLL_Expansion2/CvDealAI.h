@@ -127,6 +127,10 @@ public:
 	void DoTradeScreenClosed(bool bAIWasMakingOffer);
 
 private:
+#ifdef AUI_DEAL_AI_INCREMENTAL_VALUATION
+	void AddItemValueToDealValue(int iItemValue, bool bFromMe, int& iTotalValue, int& iValueImOffering, int& iValueTheyreOffering) const;
+
+#endif
 	CvPlayer* m_pPlayer;
 
 	int m_iCachedValueOfPeaceWithHuman;		// NOT SERIALIZED
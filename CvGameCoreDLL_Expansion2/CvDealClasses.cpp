@@ -784,7 +784,11 @@ bool CvDeal::IsPossibleToTradeItem(PlayerTypes ePlayer, PlayerTypes eToPlayer, T
 			return false;
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("IsAbleToMakePeace"))
+#else
 		if (pkScriptSystem)
+#endif
 		{
 			// Construct and push in some event arguments.
 			CvLuaArgsHandle args;
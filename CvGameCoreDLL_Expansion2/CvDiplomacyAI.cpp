@@ -7500,9 +7500,11 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerMilitaryThreats()
 
 	int iPlayerMilitaryStrength;
 
+#ifndef AUI_GAME_SHARED_CIV_PAIR_METRICS
 	CvCity* pLoopCity;
 	int iCityLoop;
 	int iCityStrengthMod;
+#endif
 
 	int iThirdPlayerMilitaryStrength;
 	int iMilitaryRatio;
@@ -7521,6 +7523,9 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerMilitaryThreats()
 			iPlayerMilitaryStrength = GET_PLAYER(eLoopPlayer).GetMilitaryMight();
 
 			// Add in City Defensive Strength
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+			iPlayerMilitaryStrength += GC.getGame().GetCityDefenseMilitaryStrength(eLoopPlayer);
+#else
 			for(pLoopCity = GET_PLAYER(eLoopPlayer).firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = GET_PLAYER(eLoopPlayer).nextCity(&iCityLoop))
 			{
 				iCityStrengthMod = pLoopCity->GetPower();
@@ -7531,6 +7536,7 @@ void CvDiplomacyAI::DoUpdateEstimateOtherPlayerMilitaryThreats()
 				iCityStrengthMod /= 100;
 				iPlayerMilitaryStrength += (MAX(iCityStrengthMod, 0));
 			}
+#endif
 
 			// Prevent divide by 0
 			if(iPlayerMilitaryStrength == 0)
@@ -22808,7 +22814,11 @@ int CvDiplomacyAI::GetSupportedMyHostingScore(PlayerTypes ePlayer)
 int CvDiplomacyAI::GetScenarioModifier1(PlayerTypes ePlayer)
 {
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("GetScenarioDiploModifier1"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(m_pPlayer->GetID());
@@ -22827,7 +22837,11 @@ int CvDiplomacyAI::GetScenarioModifier1(PlayerTypes ePlayer)
 int CvDiplomacyAI::GetScenarioModifier2(PlayerTypes ePlayer)
 {
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("GetScenarioDiploModifier2"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(m_pPlayer->GetID());
@@ -22846,7 +22860,11 @@ int CvDiplomacyAI::GetScenarioModifier2(PlayerTypes ePlayer)
 int CvDiplomacyAI::GetScenarioModifier3(PlayerTypes ePlayer)
 {
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("GetScenarioDiploModifier3"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(m_pPlayer->GetID());
@@ -1017,7 +1017,11 @@ void CvDllNetMessageHandler::ResponseSellBuilding(PlayerTypes ePlayer, int iCity
 		pCity->GetCityBuildings()->DoSellBuilding(eBuilding);
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("CitySoldBuilding"))
+#else
 		if (pkScriptSystem) 
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(ePlayer);
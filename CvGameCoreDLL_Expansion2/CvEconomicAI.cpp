@@ -732,7 +732,11 @@ void CvEconomicAI::DoTurn()
 
 				// Check Lua hook
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if(pkScriptSystem && bStrategyShouldBeActive && LuaSupport::HasGameEventListeners("EconomicStrategyCanActivate"))
+#else
 				if(pkScriptSystem && bStrategyShouldBeActive)
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(iStrategiesLoop);
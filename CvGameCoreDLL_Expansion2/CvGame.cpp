@@ -1168,6 +1168,18 @@ void CvGame::reset(HandicapTypes eHandicap, bool bConstructorCall)
 	// Uninit class
 	uninit();
 
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	ResetCivPairMetrics();
+#endif
+#ifdef AUI_GAME_AUTOPLAY_BENCHMARK_LOG
+	m_kLastAutoplayBenchmarkTicks.QuadPart = 0;
+	m_bHasAutoplayBenchmarkTurn = false;
+#endif
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	// New game or load, mods may have changed which GameEvents are listened to
+	LuaSupport::RefreshGameEventListeners();
+
+#endif
 	m_fCurrentTurnTimerPauseDelta = 0.f;
 
 	CvString strUTF8DatabasePath = gDLL->GetCacheFolderPath();
@@ -1534,10 +1546,19 @@ void CvGame::update()
 		}
 	}
 
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	// Scripts may have (un)registered GameEvents listeners since the last update
+	LuaSupport::RefreshGameEventListeners();
+
+#endif
 	// Send a Lua event at the start of the update
 	{
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if(pkScriptSystem && LuaSupport::HasGameEventListeners("GameCoreUpdateBegin"))
+#else
 		if(pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			bool bResult;
@@ -1657,7 +1678,11 @@ void CvGame::update()
 	// Send a Lua event at the end of the update
 	{
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if(pkScriptSystem && LuaSupport::HasGameEventListeners("GameCoreUpdateEnd"))
+#else
 		if(pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			bool bResult;
@@ -3688,7 +3713,11 @@ void CvGame::doControl(ControlTypes eControl)
 		if(GC.GetEngineUserInterface()->canEndTurn() && gDLL->allAICivsProcessedThisTurn() && allUnitAIProcessed())
 		{
 			CvPlayerAI& kActivePlayer = GET_PLAYER(getActivePlayer());
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+			if (!isNetworkMultiPlayer() && kActivePlayer.isHuman() && GC.GetPostTurnAutosaves() && IsAutosaveTurn())
+#else
 			if (!isNetworkMultiPlayer() && kActivePlayer.isHuman() && GC.GetPostTurnAutosaves())
+#endif
 			{
 				gDLL->AutoSave(false, true);
 			}
@@ -4730,6 +4759,18 @@ int CvGame::getElapsedGameTurns() const
 	return m_iElapsedGameTurns;
 }
 
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+//	--------------------------------------------------------------------------------
+/// Should per-turn autosaves requested by the game core be written this turn? Always true unless AUTOSAVE_TURN_INTERVAL was raised above 1
+bool CvGame::IsAutosaveTurn() const
+{
+	const int iInterval = GC.getAUTOSAVE_TURN_INTERVAL();
+	if (iInterval <= 1)
+		return true;
+	return (getElapsedGameTurns() % iInterval) == 0;
+}
+#endif
+
 
 //	--------------------------------------------------------------------------------
 void CvGame::incrementElapsedGameTurns()
@@ -5416,7 +5457,11 @@ bool CvGame::circumnavigationAvailable() const
 void CvGame::DoFromUIDiploEvent(FromUIDiploEventTypes eEvent, PlayerTypes eAIPlayer, int iArg1, int iArg2)
 {
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("UiDiploEvent"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(eEvent);
@@ -7965,13 +8010,25 @@ void CvGame::doTurn()
 	char temp[256];
 	sprintf_s(temp, "Turn %i\n", getGameTurn());
 	OutputDebugString(temp);
+#ifdef AUI_HIERARCHICAL_TURN_PROFILER
+	// Everything recorded since the last turn change (including the players' AI turns) belongs to the turn that is ending
+	cvTurnProfiler::FlushTurn(getElapsedGameTurns());
+#endif
+#endif
+#ifdef AUI_GAME_AUTOPLAY_BENCHMARK_LOG
+	LogAutoplayBenchmarkTurn();
 #endif
+	AI_PROFILE_SCOPE("CvGame::doTurn");
 
 	int aiShuffle[MAX_PLAYERS];
 	int iLoopPlayer;
 	int iI;
 
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+	if(getAIAutoPlay() && IsAutosaveTurn())
+#else
 	if(getAIAutoPlay())
+#endif
 	{
 		gDLL->AutoSave(false);
 	}
@@ -8004,15 +8061,21 @@ void CvGame::doTurn()
 	m_kGameDeals.DoTurn();
 #endif
 
-	for(iI = 0; iI < MAX_TEAMS; iI++)
 	{
-		if(GET_TEAM((TeamTypes)iI).isAlive())
+		AI_PROFILE_SCOPE("CvTeam::doTurn");
+		for(iI = 0; iI < MAX_TEAMS; iI++)
 		{
-			GET_TEAM((TeamTypes)iI).doTurn();
+			if(GET_TEAM((TeamTypes)iI).isAlive())
+			{
+				GET_TEAM((TeamTypes)iI).doTurn();
+			}
 		}
 	}
 
-	GC.getMap().doTurn();
+	{
+		AI_PROFILE_SCOPE("CvMap::doTurn");
+		GC.getMap().doTurn();
+	}
 
 #ifdef AUI_WARNING_FIXES
 	kEngineUserInterface.doTurn();
@@ -8191,7 +8254,11 @@ void CvGame::doTurn()
 
 	LogGameState();
 
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+	if(isNetworkMultiPlayer() && IsAutosaveTurn())
+#else
 	if(isNetworkMultiPlayer())
+#endif
 	{//autosave after doing a turn
 		gDLL->AutoSave(false);
 	}
@@ -9519,7 +9586,11 @@ void CvGame::testVictory()
 
 	// Send a game event to allow a Lua script to set the victory state
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("GameCoreTestVictory"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		bool bResult;
@@ -11655,6 +11726,235 @@ void CvGame::BuildCannotPerformActionHelpText(CvString* toolTipSink, const char*
 	}
 }
 
+#ifdef AUI_GAME_AUTOPLAY_BENCHMARK_LOG
+//	--------------------------------------------------------------------------------
+/// Folds one value into an FNV-1a style hash
+static inline void HashBenchmarkValue(uint& uiHash, int iValue)
+{
+	uiHash ^= (uint)iValue;
+	uiHash *= 16777619;
+}
+
+//	--------------------------------------------------------------------------------
+/// Hash of every state group calculateSyncChecksum() samples, taken together: unlike the sync checksum it doesn't depend on the turn slice, so two runs from the same save log the same value for the same state
+uint CvGame::CalculateBenchmarkStateHash()
+{
+	uint uiHash = 2166136261U;
+
+#ifdef AUI_USE_SFMT_RNG
+	HashBenchmarkValue(uiHash, getMapRand().getSeed().first);
+	HashBenchmarkValue(uiHash, getMapRand().getSeed().second);
+	HashBenchmarkValue(uiHash, getJonRand().getSeed().first);
+	HashBenchmarkValue(uiHash, getJonRand().getSeed().second);
+#else
+	HashBenchmarkValue(uiHash, getMapRand().getSeed());
+	HashBenchmarkValue(uiHash, getJonRand().getSeed());
+#endif
+
+	HashBenchmarkValue(uiHash, getNumCities());
+	HashBenchmarkValue(uiHash, getTotalPopulation());
+	HashBenchmarkValue(uiHash, GC.getMap().getOwnedPlots());
+	HashBenchmarkValue(uiHash, GC.getMap().getNumAreas());
+
+	for (int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		PlayerTypes ePlayer = static_cast<PlayerTypes>(iI);
+		CvPlayer& kPlayer = GET_PLAYER(ePlayer);
+		if (!kPlayer.isEverAlive())
+			continue;
+
+		HashBenchmarkValue(uiHash, iI);
+		HashBenchmarkValue(uiHash, getPlayerScore(ePlayer));
+
+		HashBenchmarkValue(uiHash, kPlayer.getTotalPopulation());
+		HashBenchmarkValue(uiHash, kPlayer.getTotalLand());
+		HashBenchmarkValue(uiHash, kPlayer.GetTreasury()->GetGold());
+		HashBenchmarkValue(uiHash, kPlayer.getPower());
+		HashBenchmarkValue(uiHash, kPlayer.getNumCities());
+		HashBenchmarkValue(uiHash, kPlayer.getNumUnits());
+
+		for (int iJ = 0; iJ < NUM_YIELD_TYPES; iJ++)
+		{
+			HashBenchmarkValue(uiHash, kPlayer.calculateTotalYield((YieldTypes)iJ));
+		}
+
+		for (int iJ = 0; iJ < (int)GC.getNumImprovementInfos(); iJ++)
+		{
+			HashBenchmarkValue(uiHash, kPlayer.getImprovementCount((ImprovementTypes)iJ));
+		}
+		for (int iJ = 0; iJ < (int)GC.getNumBuildingClassInfos(); iJ++)
+		{
+			if (GC.getBuildingClassInfo((BuildingClassTypes)iJ))
+				HashBenchmarkValue(uiHash, kPlayer.getBuildingClassCountPlusMaking((BuildingClassTypes)iJ));
+		}
+		for (int iJ = 0; iJ < (int)GC.getNumUnitClassInfos(); iJ++)
+		{
+			if (GC.getUnitClassInfo((UnitClassTypes)iJ))
+				HashBenchmarkValue(uiHash, kPlayer.getUnitClassCountPlusMaking((UnitClassTypes)iJ));
+		}
+
+		const CvUnit* pLoopUnit;
+		int iLoop;
+		for (pLoopUnit = kPlayer.firstUnit(&iLoop); pLoopUnit != NULL; pLoopUnit = kPlayer.nextUnit(&iLoop))
+		{
+			HashBenchmarkValue(uiHash, pLoopUnit->getX());
+			HashBenchmarkValue(uiHash, pLoopUnit->getY());
+			HashBenchmarkValue(uiHash, pLoopUnit->getDamage());
+			HashBenchmarkValue(uiHash, pLoopUnit->getExperience());
+			HashBenchmarkValue(uiHash, pLoopUnit->getLevel());
+		}
+	}
+
+	return uiHash;
+}
+
+//	--------------------------------------------------------------------------------
+/// Called at the start of every doTurn(): the time since the previous call covers all of the previous turn's processing (including every player's AI turn)
+void CvGame::LogAutoplayBenchmarkTurn()
+{
+	if (getAIAutoPlay() <= 0 || !GC.getAIPerfLogging())
+	{
+		m_bHasAutoplayBenchmarkTurn = false;
+		return;
+	}
+
+	LARGE_INTEGER currentTicks;
+	QueryPerformanceCounter(&currentTicks);
+
+	FILogFile* pLog = LOGFILEMGR.GetLog("AI-perf-autoplay.csv", FILogFile::kDontTimeStamp);
+	if (pLog)
+	{
+		if (!m_bHasAutoplayBenchmarkTurn)
+		{
+			pLog->Msg("Turn, Milliseconds, Plots, Civs Alive, State Hash");
+		}
+		else
+		{
+			LARGE_INTEGER ticksPerSecond;
+			QueryPerformanceFrequency(&ticksPerSecond);
+			const double dMilliseconds = (double)(currentTicks.QuadPart - m_kLastAutoplayBenchmarkTicks.QuadPart) * 1000.0 / (double)ticksPerSecond.QuadPart;
+
+			CvString strOutput;
+			strOutput.Format("%03d, %.1f, %d, %d, %08x", getElapsedGameTurns(), dMilliseconds, GC.getMap().numPlots(), countCivPlayersAlive(), CalculateBenchmarkStateHash());
+			pLog->Msg(strOutput);
+		}
+	}
+
+	m_kLastAutoplayBenchmarkTicks = currentTicks;
+	m_bHasAutoplayBenchmarkTurn = true;
+}
+#endif
+
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+//	--------------------------------------------------------------------------------
+void CvGame::ResetCivPairMetrics()
+{
+	memset(m_aaCivPairCityDistances, 0, sizeof(m_aaCivPairCityDistances));
+	for (int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		m_auiPlayerCityLayoutRevision[iI] = 1;
+		m_aiCityDefenseMilitaryStrength[iI] = 0;
+		m_abCityDefenseMilitaryStrengthDirty[iI] = true;
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Called whenever ePlayer gains or loses a city, so every pair involving ePlayer gets recomputed on its next read
+void CvGame::InvalidatePlayerCityLayout(PlayerTypes ePlayer)
+{
+	if (ePlayer >= 0 && ePlayer < MAX_PLAYERS)
+	{
+		m_auiPlayerCityLayoutRevision[ePlayer]++;
+		m_abCityDefenseMilitaryStrengthDirty[ePlayer] = true;
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Called whenever the strength, hit points or damage of one of ePlayer's cities changes
+void CvGame::InvalidateCityDefenseMilitaryStrength(PlayerTypes ePlayer)
+{
+	if (ePlayer >= 0 && ePlayer < MAX_PLAYERS)
+		m_abCityDefenseMilitaryStrengthDirty[ePlayer] = true;
+}
+
+//	--------------------------------------------------------------------------------
+/// Smallest and summed plot distance over every pair of cities between the two players; the same for both orders of the players
+void CvGame::GetCityDistancesBetweenPlayers(PlayerTypes ePlayer1, PlayerTypes ePlayer2, int& iSmallestDistance, int& iTotalDistance, int& iNumCityPairs) const
+{
+	CvAssertMsg(ePlayer1 >= 0 && ePlayer1 < MAX_PLAYERS, "ePlayer1 is expected to be within maximum bounds (invalid Index)");
+	CvAssertMsg(ePlayer2 >= 0 && ePlayer2 < MAX_PLAYERS, "ePlayer2 is expected to be within maximum bounds (invalid Index)");
+
+	if (ePlayer2 < ePlayer1)
+	{
+		PlayerTypes eTemp = ePlayer1;
+		ePlayer1 = ePlayer2;
+		ePlayer2 = eTemp;
+	}
+
+	CivPairCityDistances& kEntry = m_aaCivPairCityDistances[ePlayer1][ePlayer2];
+	if (kEntry.uiRevision1 != m_auiPlayerCityLayoutRevision[ePlayer1] || kEntry.uiRevision2 != m_auiPlayerCityLayoutRevision[ePlayer2])
+	{
+		kEntry.uiRevision1 = m_auiPlayerCityLayoutRevision[ePlayer1];
+		kEntry.uiRevision2 = m_auiPlayerCityLayoutRevision[ePlayer2];
+		kEntry.iSmallestDistance = GC.getMap().numPlots();
+		kEntry.iTotalDistance = 0;
+		kEntry.iNumCityPairs = 0;
+
+		const CvPlayer& kPlayer1 = GET_PLAYER(ePlayer1);
+		const CvPlayer& kPlayer2 = GET_PLAYER(ePlayer2);
+		const CvCity* pLoopCity1;
+		const CvCity* pLoopCity2;
+		int iCityLoop1;
+		int iCityLoop2;
+		for (pLoopCity1 = kPlayer1.firstCity(&iCityLoop1); pLoopCity1 != NULL; pLoopCity1 = kPlayer1.nextCity(&iCityLoop1))
+		{
+			for (pLoopCity2 = kPlayer2.firstCity(&iCityLoop2); pLoopCity2 != NULL; pLoopCity2 = kPlayer2.nextCity(&iCityLoop2))
+			{
+				int iDistance = plotDistance(pLoopCity1->getX(), pLoopCity1->getY(), pLoopCity2->getX(), pLoopCity2->getY());
+				if (iDistance < kEntry.iSmallestDistance)
+					kEntry.iSmallestDistance = iDistance;
+				kEntry.iTotalDistance += iDistance;
+				kEntry.iNumCityPairs++;
+			}
+		}
+	}
+
+	iSmallestDistance = kEntry.iSmallestDistance;
+	iTotalDistance = kEntry.iTotalDistance;
+	iNumCityPairs = kEntry.iNumCityPairs;
+}
+
+//	--------------------------------------------------------------------------------
+/// Defensive strength of ePlayer's cities scaled by their remaining hit points, as the diplomacy AI adds it to military might; only recomputed after one of the inputs changes, so it always matches a fresh sum
+int CvGame::GetCityDefenseMilitaryStrength(PlayerTypes ePlayer) const
+{
+	CvAssertMsg(ePlayer >= 0 && ePlayer < MAX_PLAYERS, "ePlayer is expected to be within maximum bounds (invalid Index)");
+
+	if (m_abCityDefenseMilitaryStrengthDirty[ePlayer])
+	{
+		m_abCityDefenseMilitaryStrengthDirty[ePlayer] = false;
+
+		int iStrength = 0;
+		const CvPlayer& kPlayer = GET_PLAYER(ePlayer);
+		const CvCity* pLoopCity;
+		int iCityLoop;
+		for (pLoopCity = kPlayer.firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = kPlayer.nextCity(&iCityLoop))
+		{
+			int iCityStrengthMod = pLoopCity->GetPower();
+			iCityStrengthMod *= (pLoopCity->GetMaxHitPoints() - pLoopCity->getDamage());
+			iCityStrengthMod /= pLoopCity->GetMaxHitPoints();
+			iCityStrengthMod /= 100;
+			iCityStrengthMod *= /*33*/ GC.getMILITARY_STRENGTH_CITY_MOD();
+			iCityStrengthMod /= 100;
+			iStrength += (MAX(iCityStrengthMod, 0));
+		}
+		m_aiCityDefenseMilitaryStrength[ePlayer] = iStrength;
+	}
+
+	return m_aiCityDefenseMilitaryStrength[ePlayer];
+}
+#endif
+
 //	--------------------------------------------------------------------------------
 void CvGame::LogGameState(bool bLogHeaders)
 {
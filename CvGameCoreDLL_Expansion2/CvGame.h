@@ -162,6 +162,9 @@ public:
 
 	int getElapsedGameTurns() const;
 	void incrementElapsedGameTurns();
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+	bool IsAutosaveTurn() const;
+#endif
 
 	int getMaxTurns() const;
 	void setMaxTurns(int iNewValue);
@@ -573,6 +576,15 @@ public:
 #endif
 
 	void LogGameState(bool bLogHeaders = false);
+#ifdef AUI_GAME_AUTOPLAY_BENCHMARK_LOG
+	void LogAutoplayBenchmarkTurn();
+#endif
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	void GetCityDistancesBetweenPlayers(PlayerTypes ePlayer1, PlayerTypes ePlayer2, int& iSmallestDistance, int& iTotalDistance, int& iNumCityPairs) const;
+	int GetCityDefenseMilitaryStrength(PlayerTypes ePlayer) const;
+	void InvalidatePlayerCityLayout(PlayerTypes ePlayer);
+	void InvalidateCityDefenseMilitaryStrength(PlayerTypes ePlayer);
+#endif
 	void unitIsMoving();
 
 	void BuildProdModHelpText(CvString* toolTipSink, const char* strTextKey, int iMod, const char* strExtraKey = "") const;
@@ -828,6 +840,29 @@ protected:
 
 	void doUpdateCacheOnTurn();
 
+#ifdef AUI_GAME_AUTOPLAY_BENCHMARK_LOG
+	uint CalculateBenchmarkStateHash();
+	// Not saved; cleared by reset() so the first turn after a new game or load only starts a new section of the log
+	LARGE_INTEGER m_kLastAutoplayBenchmarkTicks;
+	bool m_bHasAutoplayBenchmarkTurn;
+#endif
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	// None of this is saved; pair entries are only valid while both players' city layout revisions match, per-player entries until one of that player's cities changes
+	struct CivPairCityDistances
+	{
+		uint uiRevision1;
+		uint uiRevision2;
+		int iSmallestDistance;
+		int iTotalDistance;
+		int iNumCityPairs;
+	};
+	void ResetCivPairMetrics();
+	mutable CivPairCityDistances m_aaCivPairCityDistances[MAX_PLAYERS][MAX_PLAYERS];
+	uint m_auiPlayerCityLayoutRevision[MAX_PLAYERS];
+	mutable int m_aiCityDefenseMilitaryStrength[MAX_PLAYERS];
+	mutable bool m_abCityDefenseMilitaryStrengthDirty[MAX_PLAYERS];
+#endif
+
 	void CheckPlayerTurnDeactivate();
 
 	void PopulateDigSite(CvPlot& kPlot, EraTypes eEra, GreatWorkArtifactClass eArtifact);
@@ -89,10 +89,19 @@ template<class T> inline T FastMin(const T& _Left, const T& _Right) { return (_D
 #define AI_PERF(perfFileName, baseStringName) cvStopWatch kPerfTimer(baseStringName, perfFileName, FILogFile::kDontTimeStamp, !GC.getAIPerfLogging(), true)
 #define AI_PERF_FORMAT(perfFileName, FormatValue) CvString szPerfString; szPerfString.Format##FormatValue; cvStopWatch kPerfTimer(szPerfString, perfFileName, FILogFile::kDontTimeStamp, !GC.getAIPerfLogging(), true)
 #define AI_PERF_FORMAT_NESTED(perfFileName, FormatValue) CvString szPerfString2; szPerfString2.Format##FormatValue; cvStopWatch kPerfTimer2(szPerfString2, perfFileName, FILogFile::kDontTimeStamp, !GC.getAIPerfLogging(), true)
+#ifdef AUI_HIERARCHICAL_TURN_PROFILER
+#define AI_PROFILE_SCOPE(szScopeName) cvProfileScope kProfileScope(szScopeName)
+#define AI_PROFILE_SCOPE_PLAYER(szScopeName, ePlayer) cvProfileScope kProfileScope(szScopeName, (int)(ePlayer))
+#else
+#define AI_PROFILE_SCOPE(szScopeName) ((void)0)
+#define AI_PROFILE_SCOPE_PLAYER(szScopeName, ePlayer) ((void)0)
+#endif
 #else
 #define AI_PERF(perfFileName, baseStringName) ((void)0)
 #define AI_PERF_FORMAT(perfFileName, FormatValue) ((void)0)
 #define AI_PERF_FORMAT_NESTED(perfFileName, FormatValue) ((void)0)
+#define AI_PROFILE_SCOPE(szScopeName) ((void)0)
+#define AI_PROFILE_SCOPE_PLAYER(szScopeName, ePlayer) ((void)0)
 #endif
 
 #include <FireWorks/FDefNew.h>
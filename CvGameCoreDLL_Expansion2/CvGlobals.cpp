@@ -164,6 +164,9 @@ CvGlobals::CvGlobals() :
 #ifdef AUI_PROCESS_PRODUCTION_AI_LUA_FLAVOR_WEIGHTS
 	GD_INT_INIT(DISABLE_PROCESS_AI_FLAVOR_LUA_MODDING, 0),
 #endif
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+	GD_INT_INIT(AUTOSAVE_TURN_INTERVAL, 1),
+#endif
 #ifdef NQM_OPTIONAL_SCORING_TWEAKS
 	GD_INT_INIT(NEW_SCORE_CITY_MULTIPLIER, 0),
 	GD_INT_INIT(NEW_SCORE_POPULATION_MULTIPLIER, 0),
@@ -2482,6 +2485,9 @@ bool CvGlobals::getAIPerfLogging()
 void CvGlobals::setAIPerfLogging(bool bEnable)
 {
 	m_bAIPerfLogging = bEnable;
+#if defined(AUI_HIERARCHICAL_TURN_PROFILER) && !defined(FINAL_RELEASE)
+	cvTurnProfiler::SetEnabled(bEnable);
+#endif
 }
 
 bool CvGlobals::GetBuilderAILogging()
@@ -4967,6 +4973,9 @@ void CvGlobals::cacheGlobals()
 #ifdef AUI_PROCESS_PRODUCTION_AI_LUA_FLAVOR_WEIGHTS
 	GD_INT_CACHE(DISABLE_PROCESS_AI_FLAVOR_LUA_MODDING);
 #endif
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+	GD_INT_CACHE(AUTOSAVE_TURN_INTERVAL);
+#endif
 #ifdef NQM_OPTIONAL_SCORING_TWEAKS
 	GD_INT_CACHE(NEW_SCORE_CITY_MULTIPLIER);
 	GD_INT_CACHE(NEW_SCORE_POPULATION_MULTIPLIER);
@@ -851,6 +851,9 @@ public:
 #ifdef AUI_PROCESS_PRODUCTION_AI_LUA_FLAVOR_WEIGHTS
 	GD_INT_DEF(DISABLE_PROCESS_AI_FLAVOR_LUA_MODDING);
 #endif
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+	GD_INT_DEF(AUTOSAVE_TURN_INTERVAL);
+#endif
 #ifdef NQM_OPTIONAL_SCORING_TWEAKS
 	GD_INT_DEF(NEW_SCORE_CITY_MULTIPLIER);
 	GD_INT_DEF(NEW_SCORE_POPULATION_MULTIPLIER);
@@ -7947,6 +7950,9 @@ protected:
 #ifdef AUI_PROCESS_PRODUCTION_AI_LUA_FLAVOR_WEIGHTS
 	GD_INT_DECL(DISABLE_PROCESS_AI_FLAVOR_LUA_MODDING);
 #endif
+#ifdef AUI_GAME_AUTOSAVE_TURN_INTERVAL
+	GD_INT_DECL(AUTOSAVE_TURN_INTERVAL);
+#endif
 #ifdef NQM_OPTIONAL_SCORING_TWEAKS
 	GD_INT_DECL(NEW_SCORE_CITY_MULTIPLIER);
 	GD_INT_DECL(NEW_SCORE_POPULATION_MULTIPLIER);
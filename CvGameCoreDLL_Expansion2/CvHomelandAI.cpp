@@ -147,22 +147,35 @@ void CvHomelandAI::DoTurn()
 void CvHomelandAI::Update()
 {
 	AI_PERF_FORMAT("AI-perf.csv", ("Homeland AI, Turn %03d, %s", GC.getGame().getElapsedGameTurns(), m_pPlayer->getCivilizationShortDescription()));
+	AI_PROFILE_SCOPE("CvHomelandAI::Update");
 
 	// Make sure we have a unit to handle
 	if(!m_CurrentTurnUnits.empty())
 	{
 		// Make sure the economic plots are up-to-date, it has a caching system in it.
-		CvEconomicAI* pEconomicAI = m_pPlayer->GetEconomicAI();
-		pEconomicAI->UpdatePlots();
+		{
+			AI_PROFILE_SCOPE("CvEconomicAI::UpdatePlots");
+			CvEconomicAI* pEconomicAI = m_pPlayer->GetEconomicAI();
+			pEconomicAI->UpdatePlots();
+		}
 
 		// Start by establishing the priority order for moves this turn
-		EstablishHomelandPriorities();
+		{
+			AI_PROFILE_SCOPE("EstablishHomelandPriorities");
+			EstablishHomelandPriorities();
+		}
 
 		// Put together lists of places we may want to move toward
-		FindHomelandTargets();
+		{
+			AI_PROFILE_SCOPE("FindHomelandTargets");
+			FindHomelandTargets();
+		}
 
 		// Loop through each move assigning units when available
-		AssignHomelandMoves();
+		{
+			AI_PROFILE_SCOPE("AssignHomelandMoves");
+			AssignHomelandMoves();
+		}
 	}
 }
 
@@ -2289,7 +2302,11 @@ void CvHomelandAI::ExecuteExplorerMoves()
 		}
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if(pkScriptSystem && LuaSupport::HasGameEventListeners("UnitGetSpecialExploreTarget"))
+#else
 		if(pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(pUnit->getOwner());
@@ -23,6 +23,10 @@
 #include "CvAStar.h"
 #include "CvInfos.h"
 #include "CvInfosSerializationHelper.h"
+#ifdef AUI_MAP_SECTIONED_PLOT_SAVE
+#include "FMemoryStream.h"
+#include <stdexcept>
+#endif
 // for GUIDs
 typedef struct tagMSG* LPMSG;
 #include <objbase.h>
@@ -248,6 +252,15 @@ CvMap::CvMap()
 	m_pResourceForceReveal = NULL;
 
 	m_iAIMapHints = 0;
+#ifdef AUI_PLOT_CHANGE_STAMPS
+	m_uiPlotChangeStamp = 0;
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	m_uiStepPassabilityStamp = 0;
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	m_uiPathCostStamp = 0;
+#endif
 
 	reset(&defaultMapData);
 }
@@ -443,6 +456,9 @@ void CvMap::reset(CvMapInitData* pInitInfo)
 	uninit();
 
 	m_iAIMapHints = 0;
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	NewStepPassabilityStamp();
+#endif
 	//
 	// set grid size
 	// initially set in terrain cell units
@@ -1579,6 +1595,14 @@ void CvMap::Read(FDataStream& kStream)
 	if(numPlots() > 0)
 	{
 		InitPlots();
+#ifdef AUI_MAP_SECTIONED_PLOT_SAVE
+		if (uiVersion >= 2)
+		{
+			ReadPlotSection(kStream);
+		}
+		else
+		{
+#endif
 #ifdef AUI_WARNING_FIXES
 		for (uint iI = 0; iI < numPlots(); iI++)
 #else
@@ -1588,6 +1612,9 @@ void CvMap::Read(FDataStream& kStream)
 		{
 			m_pMapPlots[iI].read(kStream);
 		}
+#ifdef AUI_MAP_SECTIONED_PLOT_SAVE
+		}
+#endif
 	}
 
 	// call the read of the free list CvArea class allocations
@@ -1612,7 +1639,11 @@ void CvMap::Read(FDataStream& kStream)
 void CvMap::Write(FDataStream& kStream) const
 {
 	// Current version number
+#ifdef AUI_MAP_SECTIONED_PLOT_SAVE
+	uint uiVersion = 2;
+#else
 	uint uiVersion = 1;
+#endif
 	kStream << uiVersion;
 
 	kStream << m_iGridWidth;
@@ -1634,6 +1665,13 @@ void CvMap::Write(FDataStream& kStream) const
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes>(kStream, m_paiNumResource, GC.getNumResourceInfos());
 	CvInfosSerializationHelper::WriteHashedDataArray<ResourceTypes>(kStream, m_paiNumResourceOnLand, GC.getNumResourceInfos());
 
+#ifdef AUI_MAP_SECTIONED_PLOT_SAVE
+	// Read() only expects plot data if there are plots
+	if (numPlots() > 0)
+	{
+		WritePlotSection(kStream);
+	}
+#else
 #ifdef AUI_WARNING_FIXES
 	for (uint iI = 0; iI < numPlots(); iI++)
 #else
@@ -1643,6 +1681,7 @@ void CvMap::Write(FDataStream& kStream) const
 	{
 		m_pMapPlots[iI].write(kStream);
 	}
+#endif
 
 	// call the read of the free list CvArea class allocations
 	kStream << m_areas;
@@ -1653,6 +1692,213 @@ void CvMap::Write(FDataStream& kStream) const
 
 }
 
+#ifdef AUI_MAP_SECTIONED_PLOT_SAVE
+//	--------------------------------------------------------------------------------
+/// Layout: number of rows, byte offset of every row plus the section's end, section size, CRC32 of the section, then the section itself (every plot of every row, in plot index order)
+void CvMap::WritePlotSection(FDataStream& kStream) const
+{
+	const int iNumRows = m_iGridHeight;
+	std::vector<uint> auiRowOffsets(iNumRows + 1, 0);
+
+	FMemoryStream kSection;
+	for (int iY = 0; iY < iNumRows; iY++)
+	{
+		auiRowOffsets[iY] = kSection.GetEOF();
+		const int iRowStart = iY * m_iGridWidth;
+		for (int iX = 0; iX < m_iGridWidth; iX++)
+		{
+			m_pMapPlots[iRowStart + iX].write(kSection);
+		}
+	}
+	const uint uiSectionSize = kSection.GetEOF();
+	auiRowOffsets[iNumRows] = uiSectionSize;
+
+	kStream << iNumRows;
+	for (int iI = 0; iI <= iNumRows; iI++)
+	{
+		kStream << auiRowOffsets[iI];
+	}
+	kStream << uiSectionSize;
+	kStream << (uint)g_CRC32.Calc(kSection.GetBuf(), uiSectionSize);
+	kStream.WriteIt(uiSectionSize, kSection.GetBuf());
+}
+
+//	--------------------------------------------------------------------------------
+/// Read-only stream over one row of an already loaded plot section, so rows are decoded in place instead of being copied out first
+class CvPlotSectionRowStream : public FDataStream
+{
+public:
+	CvPlotSectionRowStream(const char* pData, uint uiSize) : m_pData(pData), m_uiSize(uiSize), m_uiPosition(0), m_bOverrun(false)
+	{
+	}
+
+	virtual unsigned int ReadIt(unsigned int byteCount, void* buffer)
+	{
+		uint uiCount = MIN(byteCount, m_uiSize - m_uiPosition);
+		memcpy(buffer, m_pData + m_uiPosition, uiCount);
+		if (uiCount < byteCount)
+		{
+			// Reading past the row means the plot data doesn't match its table of contents
+			memset((char*)buffer + uiCount, 0, byteCount - uiCount);
+			m_bOverrun = true;
+		}
+		m_uiPosition += uiCount;
+		return uiCount;
+	}
+	virtual unsigned int WriteIt(unsigned int, const void*)
+	{
+		CvAssertMsg(false, "Plot section rows are read-only");
+		return 0;
+	}
+	virtual void Skip(unsigned int deltaByteCount)
+	{
+		if (deltaByteCount > m_uiSize - m_uiPosition)
+		{
+			m_bOverrun = true;
+			deltaByteCount = m_uiSize - m_uiPosition;
+		}
+		m_uiPosition += deltaByteCount;
+	}
+	virtual void Rewind()
+	{
+		m_uiPosition = 0;
+	}
+	virtual bool AtEnd() const
+	{
+		return m_uiPosition >= m_uiSize;
+	}
+	virtual void FastFwd()
+	{
+		m_uiPosition = m_uiSize;
+	}
+	virtual unsigned int GetPosition() const
+	{
+		return m_uiPosition;
+	}
+	virtual void SetPosition(unsigned int position)
+	{
+		m_uiPosition = MIN(position, m_uiSize);
+	}
+	virtual unsigned int GetEOF() const
+	{
+		return m_uiSize;
+	}
+	virtual unsigned int GetSizeLeft() const
+	{
+		return m_uiSize - m_uiPosition;
+	}
+
+	bool IsOverrun() const
+	{
+		return m_bOverrun;
+	}
+
+private:
+	const char* m_pData;
+	uint m_uiSize;
+	uint m_uiPosition;
+	bool m_bOverrun;
+};
+
+//	--------------------------------------------------------------------------------
+/// Logs why the plot section can't be used and aborts the load through the stream, the same way a truncated save does
+static void FailPlotSectionLoad(FDataStream& kStream, const CvString& szError)
+{
+	GC.LogMessage(szError.GetCString());
+	CvAssertMsg(false, szError);
+	std::runtime_error kException(szError.GetCString());
+	kStream.RaiseException(kException);
+}
+
+//	--------------------------------------------------------------------------------
+/// Counterpart to WritePlotSection(); plots must already be allocated. Everything is validated against the stream before anything is allocated, and a section that fails validation fails the load
+void CvMap::ReadPlotSection(FDataStream& kStream)
+{
+	CvString szError;
+
+	int iNumRows;
+	kStream >> iNumRows;
+	// The row table alone has to fit in what is left of the save
+	if (iNumRows < 0 || (uint)iNumRows >= kStream.GetSizeLeft() / sizeof(uint))
+	{
+		szError.Format("LOAD ERROR: Plot section claims %d rows, which doesn't fit in the save. The save is corrupt.", iNumRows);
+		FailPlotSectionLoad(kStream, szError);
+		return;
+	}
+
+	std::vector<uint> auiRowOffsets(iNumRows + 1, 0);
+	for (int iI = 0; iI <= iNumRows; iI++)
+	{
+		kStream >> auiRowOffsets[iI];
+	}
+
+	uint uiSectionSize;
+	uint uiChecksum;
+	kStream >> uiSectionSize;
+	kStream >> uiChecksum;
+
+	if (uiSectionSize > kStream.GetSizeLeft())
+	{
+		szError.Format("LOAD ERROR: Plot section is %u bytes, but only %u bytes of the save are left. The save is corrupt.", uiSectionSize, kStream.GetSizeLeft());
+		FailPlotSectionLoad(kStream, szError);
+		return;
+	}
+
+	if (iNumRows != m_iGridHeight)
+	{
+		// Step over the section so whatever reads the stream next is still aligned
+		kStream.Skip(uiSectionSize);
+		szError.Format("LOAD ERROR: Plot section has %d rows, but the map is %d rows high. The save is corrupt.", iNumRows, m_iGridHeight);
+		FailPlotSectionLoad(kStream, szError);
+		return;
+	}
+
+	// The row table has to start at 0, never go backwards and end exactly where the section does
+	for (int iI = 0; iI <= iNumRows; iI++)
+	{
+		const uint uiMinOffset = (iI == 0) ? 0 : auiRowOffsets[iI - 1];
+		const uint uiMaxOffset = (iI == 0) ? 0 : uiSectionSize;
+		if (auiRowOffsets[iI] < uiMinOffset || auiRowOffsets[iI] > uiMaxOffset || (iI == iNumRows && auiRowOffsets[iI] != uiSectionSize))
+		{
+			kStream.Skip(uiSectionSize);
+			szError.Format("LOAD ERROR: Plot section row table entry %d (%u) is out of order in a %u byte section. The save is corrupt.", iI, auiRowOffsets[iI], uiSectionSize);
+			FailPlotSectionLoad(kStream, szError);
+			return;
+		}
+	}
+
+	// One read for the whole section instead of one per plot member
+	std::vector<char> acSection(uiSectionSize + 1);
+	kStream.ReadIt(uiSectionSize, &acSection[0]);
+
+	if (g_CRC32.Calc(&acSection[0], uiSectionSize) != uiChecksum)
+	{
+		szError.Format("LOAD ERROR: Plot section checksum mismatch. The save is corrupt.");
+		FailPlotSectionLoad(kStream, szError);
+		return;
+	}
+
+	// Rows are decoded one after another: CvPlot::read() allocates, sets script data, links units and logs, none of which is safe to do from several threads
+	for (int iY = 0; iY < iNumRows; iY++)
+	{
+		CvPlotSectionRowStream kRow(&acSection[0] + auiRowOffsets[iY], auiRowOffsets[iY + 1] - auiRowOffsets[iY]);
+
+		const int iRowStart = iY * m_iGridWidth;
+		for (int iX = 0; iX < m_iGridWidth; iX++)
+		{
+			m_pMapPlots[iRowStart + iX].read(kRow);
+		}
+
+		if (kRow.IsOverrun() || !kRow.AtEnd())
+		{
+			szError.Format("LOAD ERROR: Plot section row %d didn't decode to exactly its %u bytes. The save is corrupt.", iY, kRow.GetEOF());
+			FailPlotSectionLoad(kStream, szError);
+			return;
+		}
+	}
+}
+#endif
+
 
 //	--------------------------------------------------------------------------------
 //
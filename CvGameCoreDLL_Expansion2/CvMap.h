@@ -187,6 +187,40 @@ public:
 	int plotX(int iIndex) const;
 	int plotY(int iIndex) const;
 
+#ifdef AUI_PLOT_CHANGE_STAMPS
+	// Stamp of the most recent plot change; caches store this when they are built and compare it to CvPlot::GetChangeStamp() later
+	inline uint GetPlotChangeStamp() const
+	{
+		return m_uiPlotChangeStamp;
+	}
+	inline uint NewPlotChangeStamp()
+	{
+		return ++m_uiPlotChangeStamp;
+	}
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	// Bumped whenever something CvStepPathFinder's passability depends on changes (ownership, terrain, areas, war, open borders, ocean passage)
+	inline uint GetStepPassabilityStamp() const
+	{
+		return m_uiStepPassabilityStamp;
+	}
+	inline void NewStepPassabilityStamp()
+	{
+		++m_uiStepPassabilityStamp;
+	}
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	// Bumped whenever a plot change can alter movement costs wherever a path might run (ownership, terrain, features, improvements, routes, cities)
+	inline uint GetPathCostStamp() const
+	{
+		return m_uiPathCostStamp;
+	}
+	inline void NewPathCostStamp()
+	{
+		++m_uiPathCostStamp;
+	}
+#endif
+
 	int maxPlotDistance();
 
 #ifdef AUI_WARNING_FIXES
@@ -326,6 +360,10 @@ public:
 	// Serialization:
 	void Read(FDataStream& kStream);
 	void Write(FDataStream& kStream) const;
+#ifdef AUI_MAP_SECTIONED_PLOT_SAVE
+	void ReadPlotSection(FDataStream& kStream);
+	void WritePlotSection(FDataStream& kStream) const;
+#endif
 	GUID GetGUID() const
 	{
 		return m_guid;
@@ -366,6 +404,15 @@ protected:
 	int m_iTopLatitude;
 	int m_iBottomLatitude;
 	int m_iNumNaturalWonders;
+#ifdef AUI_PLOT_CHANGE_STAMPS
+	uint m_uiPlotChangeStamp; // not serialized, caches that use it are rebuilt after loading
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	uint m_uiStepPassabilityStamp; // not serialized, bumped on every reset so nothing built on a previous map still matches
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	uint m_uiPathCostStamp; // not serialized, danger footprints are rebuilt after loading
+#endif
 
 	int m_iAIMapHints;	// currently only:
 						// 0 for normal, 
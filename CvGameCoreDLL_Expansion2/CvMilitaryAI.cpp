@@ -1122,7 +1122,11 @@ CvMilitaryTarget CvMilitaryAI::FindBestAttackTarget(AIOperationTypes eAIOperatio
 			}
 			CvPlot *pSeaPlotNearMuster = GetCoastalPlotAdjacentToTarget(target.m_pMusterCity->plot(), NULL);
 			CvPlot *pSeaPlotNearTarget = GetCoastalPlotAdjacentToTarget(target.m_pTargetCity->plot(), NULL);
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+			if(!GC.getStepFinder().ArePlotsConnected(m_pPlayer->GetID(), eEnemy, pSeaPlotNearMuster, pSeaPlotNearTarget))
+#else
 			if(!GC.getStepFinder().DoesPathExist(m_pPlayer->GetID(), eEnemy, pSeaPlotNearMuster, pSeaPlotNearTarget))
+#endif
 			{
 				continue;
 			}
@@ -2563,7 +2567,11 @@ void CvMilitaryAI::UpdateMilitaryStrategies()
 
 				// Check Lua hook
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if(pkScriptSystem && bStrategyShouldBeActive && LuaSupport::HasGameEventListeners("MilitaryStrategyCanActivate"))
+#else
 				if(pkScriptSystem && bStrategyShouldBeActive)
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(iStrategiesLoop);
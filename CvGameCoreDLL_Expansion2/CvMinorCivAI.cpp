@@ -5793,7 +5793,11 @@ void CvMinorCivAI::SetAlly(PlayerTypes eNewAlly)
 	DoTestEndWarsVSMinors(eOldAlly, eNewAlly);
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("SetAlly"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(m_pPlayer->GetID());
@@ -5932,7 +5936,11 @@ void CvMinorCivAI::DoFriendshipChangeEffects(PlayerTypes ePlayer, int iOldFriend
 		bFriends = true;
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("MinorFriendsChanged"))
+#else
 		if (pkScriptSystem) 
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(m_pPlayer->GetID());
@@ -5952,7 +5960,11 @@ void CvMinorCivAI::DoFriendshipChangeEffects(PlayerTypes ePlayer, int iOldFriend
 		bFriends = true;
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("MinorFriendsChanged"))
+#else
 		if (pkScriptSystem) 
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(m_pPlayer->GetID());
@@ -5980,7 +5992,11 @@ void CvMinorCivAI::DoFriendshipChangeEffects(PlayerTypes ePlayer, int iOldFriend
 		bAllies = true;
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("MinorAlliesChanged"))
+#else
 		if (pkScriptSystem) 
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(m_pPlayer->GetID());
@@ -6000,7 +6016,11 @@ void CvMinorCivAI::DoFriendshipChangeEffects(PlayerTypes ePlayer, int iOldFriend
 		bAllies = true;
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("MinorAlliesChanged"))
+#else
 		if (pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(m_pPlayer->GetID());
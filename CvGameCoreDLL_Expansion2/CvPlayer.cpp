@@ -796,6 +796,9 @@ void CvPlayer::uninit()
 	m_iExtraHappinessPerLuxury = 0;
 	m_iUnhappinessFromUnits = 0;
 	m_iUnhappinessFromUnitsMod = 0;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	m_bCityUnhappinessTermsDirty = true;
+#endif
 	m_iUnhappinessMod = 0;
 	m_iCityCountUnhappinessMod = 0;
 	m_iOccupiedPopulationUnhappinessMod = 0;
@@ -4421,7 +4424,11 @@ void CvPlayer::doTurn()
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerDoTurn"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -4436,14 +4443,19 @@ void CvPlayer::doTurn()
 //	--------------------------------------------------------------------------------
 void CvPlayer::doTurnPostDiplomacy()
 {
+	AI_PROFILE_SCOPE_PLAYER("CvPlayer::doTurnPostDiplomacy", GetID());
 	CvGame& kGame = GC.getGame();
 
 	if(isAlive())
 	{
-		kGame.GetTacticalAnalysisMap()->RefreshDataForNextPlayer(this);
+		{
+			AI_PROFILE_SCOPE("CvTacticalAnalysisMap::RefreshDataForNextPlayer");
+			kGame.GetTacticalAnalysisMap()->RefreshDataForNextPlayer(this);
+		}
 
 		{
 			AI_PERF_FORMAT("AI-perf.csv", ("Plots/Danger, Turn %03d, %s", kGame.getElapsedGameTurns(), getCivilizationShortDescription()) );
+			AI_PROFILE_SCOPE("Plots/Danger");
 
 			UpdatePlots();
 			m_pDangerPlots->UpdateDanger();
@@ -4451,6 +4463,7 @@ void CvPlayer::doTurnPostDiplomacy()
 
 		if(!isBarbarian())
 		{
+			AI_PROFILE_SCOPE("Strategy AI");
 			GetEconomicAI()->DoTurn();
 			GetMilitaryAI()->DoTurn();
 			GetReligionAI()->DoTurn();
@@ -4488,6 +4501,7 @@ void CvPlayer::doTurnPostDiplomacy()
 	// Do turn for all Cities
 	{
 		AI_PERF_FORMAT("AI-perf.csv", ("Do City Turns, Turn %03d, %s", GC.getGame().getElapsedGameTurns(), getCivilizationShortDescription()) );
+		AI_PROFILE_SCOPE("CvCity::doTurn");
 		if(getNumCities() > 0)
 		{
 			int iLoop = 0;
@@ -5806,7 +5820,11 @@ bool CvPlayer::canRaze(CvCity* pCity, bool bIgnoreCapitals) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CanRazeOverride"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(pCity->getOwner());
@@ -5850,7 +5868,11 @@ bool CvPlayer::canRaze(CvCity* pCity, bool bIgnoreCapitals) const
 		}
 	}
 
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CanRaze"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(pCity->getOwner());
@@ -6266,7 +6288,11 @@ bool CvPlayer::canReceiveGoody(CvPlot* pPlot, GoodyTypes eGoody, CvUnit* pUnit)
 				{
 					bool bUseTech = true;
 					ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+					if (pkScriptSystem && LuaSupport::HasGameEventListeners("GoodyHutCanResearch"))
+#else
 					if (pkScriptSystem) 
+#endif
 					{
 						CvLuaArgsHandle args;
 						args->Push(GetID());
@@ -6873,7 +6899,11 @@ void CvPlayer::receiveGoody(CvPlot* pPlot, GoodyTypes eGoody, CvUnit* pUnit)
 				pNewUnit->setupGraphical();
 
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if (pkScriptSystem && LuaSupport::HasGameEventListeners("UnitUpgraded"))
+#else
 				if (pkScriptSystem)
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(GetID());
@@ -6910,7 +6940,11 @@ void CvPlayer::receiveGoody(CvPlot* pPlot, GoodyTypes eGoody, CvUnit* pUnit)
 					bool bUseTech = true;
 
 					ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+					if (pkScriptSystem && LuaSupport::HasGameEventListeners("GoodyHutCanResearch"))
+#else
 					if (pkScriptSystem)
+#endif
 					{
 						CvLuaArgsHandle args;
 						args->Push(GetID());
@@ -6942,7 +6976,11 @@ void CvPlayer::receiveGoody(CvPlot* pPlot, GoodyTypes eGoody, CvUnit* pUnit)
 		CvAssertMsg(eBestTech != NO_TECH, "BestTech is not assigned a valid value");
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("GoodyHutTechResearched"))
+#else
 		if (pkScriptSystem) 
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(GetID());
@@ -7412,7 +7450,11 @@ void CvPlayer::found(int iX, int iY)
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCityFounded"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -7722,7 +7764,11 @@ bool CvPlayer::canTrain(UnitTypes eUnit, bool bContinue, bool bTestVisible, bool
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanTrain"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -8034,7 +8080,11 @@ bool CvPlayer::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestV
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanConstruct"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -8203,7 +8253,11 @@ bool CvPlayer::canCreate(ProjectTypes eProject, bool bContinue, bool bTestVisibl
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanCreate"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -8230,7 +8284,11 @@ bool CvPlayer::canCreate(ProjectTypes eProject, bool bContinue, bool bTestVisibl
 bool CvPlayer::canPrepare(SpecialistTypes eSpecialist, bool) const
 {
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanPrepare"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -8285,7 +8343,11 @@ bool CvPlayer::canMaintain(ProcessTypes eProcess, bool) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanMaintain"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -9974,6 +10036,14 @@ void CvPlayer::ChangeGreatWorkYieldChange(YieldTypes eYield, int iChange)
 	if(iChange != 0)
 	{
 		m_aiGreatWorkYieldChange[eYield] = m_aiGreatWorkYieldChange[eYield] + iChange;
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+
+		int iLoop;
+		for(CvCity* pLoopCity = firstCity(&iLoop); pLoopCity != NULL; pLoopCity = nextCity(&iLoop))
+		{
+			pLoopCity->invalidateBaseYieldRateCache(eYield);
+		}
+#endif
 	}
 }
 
@@ -12639,10 +12709,176 @@ int CvPlayer::GetUnhappinessFromCityForUI(CvCity* pCity) const
 	return iNumCitiesUnhappinessTimes100 + iPopulationUnhappinessTimes100;
 }
 
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+//	--------------------------------------------------------------------------------
+/// Adds (iSign = 1) or removes (iSign = -1) one city's share of each city unhappiness term, before player-wide modifiers are applied
+void CvPlayer::AddCityUnhappinessTerms(const CvCity* pCity, int* aiTerms, int iSign, const CvCity* pAssumeCityAnnexed, const CvCity* pAssumeCityPuppeted, const CvCity* pAssumeCityGrows, const CvCity* pAssumeCityExtraSpecialist) const
+{
+	bool bOccupied = !pCity->IsIgnoreCityForHappiness() && pCity->IsOccupied() && !pCity->IsNoOccupiedUnhappiness();
+	bool bNormal = !pCity->IsIgnoreCityForHappiness() && !bOccupied;
+
+	// City and captured city counts check the puppet assumption first, population terms check the annex assumption first
+	bool bCountNormal = bNormal;
+	bool bCountOccupied = bOccupied;
+	if(pCity == pAssumeCityPuppeted)
+	{
+		bCountNormal = true;
+		bCountOccupied = false;
+	}
+	else if(pCity == pAssumeCityAnnexed)
+	{
+		bCountNormal = false;
+		bCountOccupied = true;
+	}
+	bool bPopulationNormal = bNormal;
+	bool bPopulationOccupied = bOccupied;
+	if(pCity == pAssumeCityAnnexed)
+	{
+		bPopulationNormal = false;
+		bPopulationOccupied = true;
+	}
+	else if(pCity == pAssumeCityPuppeted)
+	{
+		bPopulationNormal = true;
+		bPopulationOccupied = false;
+	}
+
+	if(bCountNormal)
+		aiTerms[CITY_UNHAPPINESS_CITY_COUNT] += iSign * /*2*/ GC.getUNHAPPINESS_PER_CITY() * 100;
+	if(bCountOccupied)
+		aiTerms[CITY_UNHAPPINESS_CAPTURED_CITY_COUNT] += iSign * /*5*/ GC.getUNHAPPINESS_PER_CAPTURED_CITY() * 100;
+
+	if(!bPopulationNormal && !bPopulationOccupied)
+		return;
+
+	int iSpecialistCount = pCity->GetCityCitizens()->GetTotalSpecialistCount();
+	int iPopulation = pCity->getPopulation();
+#if defined(AUI_CITIZENS_FIX_FORCED_AVOID_GROWTH_ONLY_WHEN_GROWING_LOWERS_HAPPINESS) || defined(AUI_CITIZENS_UNHARDCODE_SPECIALIST_VALUE_HAPPINESS)
+	if(pCity == pAssumeCityGrows)
+		iPopulation++;
+#else
+	DEBUG_VARIABLE(pAssumeCityGrows);
+#endif
+
+	// No Unhappiness from Specialist Pop? (Policies, etc.)
+	if(isHalfSpecialistUnhappiness())
+	{
+		int iRoundedSpecialists = iSpecialistCount + 1; // Round up
+#if defined(AUI_CITIZENS_FIX_FORCED_AVOID_GROWTH_ONLY_WHEN_GROWING_LOWERS_HAPPINESS) || defined(AUI_CITIZENS_UNHARDCODE_SPECIALIST_VALUE_HAPPINESS)
+		if(pCity == pAssumeCityExtraSpecialist)
+			iRoundedSpecialists++;
+#else
+		DEBUG_VARIABLE(pAssumeCityExtraSpecialist);
+#endif
+		iPopulation -= (iRoundedSpecialists / 2);
+	}
+
+	int iUnhappinessFromThisCity;
+	if(bPopulationNormal)
+	{
+		int iUnhappinessPerPop = /*1*/ GC.getUNHAPPINESS_PER_POPULATION() * 100;
+
+		iUnhappinessFromThisCity = iPopulation * iUnhappinessPerPop;
+		if(pCity->isCapital() && GetCapitalUnhappinessMod() != 0)
+		{
+			iUnhappinessFromThisCity *= (100 + GetCapitalUnhappinessMod());
+			iUnhappinessFromThisCity /= 100;
+		}
+		aiTerms[CITY_UNHAPPINESS_POPULATION] += iSign * iUnhappinessFromThisCity;
+
+		// Specialist term is only shown in the UI and never includes what-if specialists
+		int iSpecialistPopulation = iSpecialistCount;
+		if(isHalfSpecialistUnhappiness())
+		{
+			iSpecialistPopulation++; // Round up
+			iSpecialistPopulation /= 2;
+		}
+		iUnhappinessFromThisCity = iSpecialistPopulation * iUnhappinessPerPop;
+		if(pCity->isCapital() && GetCapitalUnhappinessMod() != 0)
+		{
+			iUnhappinessFromThisCity *= (100 + GetCapitalUnhappinessMod());
+			iUnhappinessFromThisCity /= 100;
+		}
+		aiTerms[CITY_UNHAPPINESS_SPECIALISTS] += iSign * iUnhappinessFromThisCity;
+	}
+	else
+	{
+		double fUnhappinessPerPop = /*1.34f*/ GC.getUNHAPPINESS_PER_OCCUPIED_POPULATION() * 100;
+
+		iUnhappinessFromThisCity = int(double(iPopulation) * fUnhappinessPerPop);
+		if(GetOccupiedPopulationUnhappinessMod() != 0)
+		{
+			iUnhappinessFromThisCity *= (100 + GetOccupiedPopulationUnhappinessMod());
+			iUnhappinessFromThisCity /= 100;
+		}
+		aiTerms[CITY_UNHAPPINESS_OCCUPIED_POPULATION] += iSign * iUnhappinessFromThisCity;
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// City unhappiness terms summed over all our cities, before player-wide modifiers. The sums are kept between calls; what-if questions are answered by swapping out the named cities' shares.
+void CvPlayer::GetCityUnhappinessTerms(int* aiTerms, const CvCity* pAssumeCityAnnexed, const CvCity* pAssumeCityPuppeted, const CvCity* pAssumeCityGrows, const CvCity* pAssumeCityExtraSpecialist) const
+{
+	int iI;
+	if(m_bCityUnhappinessTermsDirty)
+	{
+		for(iI = 0; iI < NUM_CITY_UNHAPPINESS_TERMS; iI++)
+		{
+			m_aiCityUnhappinessTerms[iI] = 0;
+		}
+
+		int iLoop;
+		for(const CvCity* pLoopCity = firstCity(&iLoop); pLoopCity != NULL; pLoopCity = nextCity(&iLoop))
+		{
+			AddCityUnhappinessTerms(pLoopCity, m_aiCityUnhappinessTerms, 1);
+		}
+		m_bCityUnhappinessTermsDirty = false;
+	}
+
+	for(iI = 0; iI < NUM_CITY_UNHAPPINESS_TERMS; iI++)
+	{
+		aiTerms[iI] = m_aiCityUnhappinessTerms[iI];
+	}
+
+	const CvCity* apAssumedCities[] = { pAssumeCityAnnexed, pAssumeCityPuppeted, pAssumeCityGrows, pAssumeCityExtraSpecialist };
+	const int iNumAssumedCities = sizeof(apAssumedCities) / sizeof(apAssumedCities[0]);
+	for(iI = 0; iI < iNumAssumedCities; iI++)
+	{
+		const CvCity* pCity = apAssumedCities[iI];
+		if(pCity == NULL || pCity->getOwner() != GetID())
+			continue;
+
+		bool bAlreadySwapped = false;
+		for(int iJ = 0; iJ < iI; iJ++)
+		{
+			if(apAssumedCities[iJ] == pCity)
+				bAlreadySwapped = true;
+		}
+		if(bAlreadySwapped)
+			continue;
+
+		AddCityUnhappinessTerms(pCity, aiTerms, -1);
+		AddCityUnhappinessTerms(pCity, aiTerms, 1, pAssumeCityAnnexed, pAssumeCityPuppeted, pAssumeCityGrows, pAssumeCityExtraSpecialist);
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Must be called whenever something checked by AddCityUnhappinessTerms() changes
+void CvPlayer::InvalidateCityUnhappinessTerms()
+{
+	m_bCityUnhappinessTermsDirty = true;
+}
+
+#endif
 //	--------------------------------------------------------------------------------
 /// Unhappiness from number of Cities
 int CvPlayer::GetUnhappinessFromCityCount(CvCity* pAssumeCityAnnexed, CvCity* pAssumeCityPuppeted) const
 {
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	int aiTerms[NUM_CITY_UNHAPPINESS_TERMS];
+	GetCityUnhappinessTerms(aiTerms, pAssumeCityAnnexed, pAssumeCityPuppeted);
+	int iUnhappiness = aiTerms[CITY_UNHAPPINESS_CITY_COUNT];
+#else
 	int iUnhappiness = 0;
 	int iUnhappinessPerCity = /*2*/ GC.getUNHAPPINESS_PER_CITY() * 100;
 
@@ -12669,6 +12905,7 @@ int CvPlayer::GetUnhappinessFromCityCount(CvCity* pAssumeCityAnnexed, CvCity* pA
 		if(bCityValid)
 			iUnhappiness += iUnhappinessPerCity;
 	}
+#endif
 
 	// Player count mod
 	int iMod = 0;
@@ -12693,6 +12930,11 @@ int CvPlayer::GetUnhappinessFromCityCount(CvCity* pAssumeCityAnnexed, CvCity* pA
 /// Unhappiness from number of Captured Cities
 int CvPlayer::GetUnhappinessFromCapturedCityCount(CvCity* pAssumeCityAnnexed, CvCity* pAssumeCityPuppeted) const
 {
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	int aiTerms[NUM_CITY_UNHAPPINESS_TERMS];
+	GetCityUnhappinessTerms(aiTerms, pAssumeCityAnnexed, pAssumeCityPuppeted);
+	int iUnhappiness = aiTerms[CITY_UNHAPPINESS_CAPTURED_CITY_COUNT];
+#else
 	int iUnhappiness = 0;
 	int iUnhappinessPerCapturedCity = /*5*/ GC.getUNHAPPINESS_PER_CAPTURED_CITY() * 100;
 
@@ -12720,6 +12962,7 @@ int CvPlayer::GetUnhappinessFromCapturedCityCount(CvCity* pAssumeCityAnnexed, Cv
 		if(bCityValid)
 			iUnhappiness += iUnhappinessPerCapturedCity;
 	}
+#endif
 
 	// Player count mod
 	int iMod = 0;
@@ -12748,6 +12991,15 @@ int CvPlayer::GetUnhappinessFromCityPopulation(CvCity* pAssumeCityAnnexed, CvCit
 int CvPlayer::GetUnhappinessFromCityPopulation(CvCity* pAssumeCityAnnexed, CvCity* pAssumeCityPuppeted) const
 #endif
 {
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	int aiTerms[NUM_CITY_UNHAPPINESS_TERMS];
+#if defined(AUI_CITIZENS_FIX_FORCED_AVOID_GROWTH_ONLY_WHEN_GROWING_LOWERS_HAPPINESS) || defined(AUI_CITIZENS_UNHARDCODE_SPECIALIST_VALUE_HAPPINESS)
+	GetCityUnhappinessTerms(aiTerms, pAssumeCityAnnexed, pAssumeCityPuppeted, pAssumeCityGrows, pAssumeCityExtraSpecialist);
+#else
+	GetCityUnhappinessTerms(aiTerms, pAssumeCityAnnexed, pAssumeCityPuppeted);
+#endif
+	int iUnhappiness = aiTerms[CITY_UNHAPPINESS_POPULATION];
+#else
 	int iUnhappiness = 0;
 	int iUnhappinessFromThisCity;
 
@@ -12806,6 +13058,7 @@ int CvPlayer::GetUnhappinessFromCityPopulation(CvCity* pAssumeCityAnnexed, CvCit
 			iUnhappiness += iUnhappinessFromThisCity;
 		}
 	}
+#endif
 
 	iUnhappiness *= (100 + GetUnhappinessMod());
 	iUnhappiness /= 100;
@@ -12885,6 +13138,11 @@ int CvPlayer::GetUnhappinessFromPuppetCityPopulation() const
 //	--------------------------------------------------------------------------------
 int CvPlayer::GetUnhappinessFromCitySpecialists(CvCity* pAssumeCityAnnexed, CvCity* pAssumeCityPuppeted) const
 {
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	int aiTerms[NUM_CITY_UNHAPPINESS_TERMS];
+	GetCityUnhappinessTerms(aiTerms, pAssumeCityAnnexed, pAssumeCityPuppeted);
+	int iUnhappiness = aiTerms[CITY_UNHAPPINESS_SPECIALISTS];
+#else
 	int iUnhappiness = 0;
 	int iUnhappinessFromThisCity;
 
@@ -12933,6 +13191,7 @@ int CvPlayer::GetUnhappinessFromCitySpecialists(CvCity* pAssumeCityAnnexed, CvCi
 			iUnhappiness += iUnhappinessFromThisCity;
 		}
 	}
+#endif
 
 	iUnhappiness *= (100 + GetUnhappinessMod());
 	iUnhappiness /= 100;
@@ -12955,6 +13214,15 @@ int CvPlayer::GetUnhappinessFromOccupiedCities(CvCity* pAssumeCityAnnexed, CvCit
 int CvPlayer::GetUnhappinessFromOccupiedCities(CvCity* pAssumeCityAnnexed, CvCity* pAssumeCityPuppeted) const
 #endif
 {
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	int aiTerms[NUM_CITY_UNHAPPINESS_TERMS];
+#if defined(AUI_CITIZENS_FIX_FORCED_AVOID_GROWTH_ONLY_WHEN_GROWING_LOWERS_HAPPINESS) || defined(AUI_CITIZENS_UNHARDCODE_SPECIALIST_VALUE_HAPPINESS)
+	GetCityUnhappinessTerms(aiTerms, pAssumeCityAnnexed, pAssumeCityPuppeted, pAssumeCityGrows, pAssumeCityExtraSpecialist);
+#else
+	GetCityUnhappinessTerms(aiTerms, pAssumeCityAnnexed, pAssumeCityPuppeted);
+#endif
+	int iUnhappiness = aiTerms[CITY_UNHAPPINESS_OCCUPIED_POPULATION];
+#else
 	int iUnhappiness = 0;
 	int iUnhappinessFromThisCity;
 
@@ -13015,6 +13283,7 @@ int CvPlayer::GetUnhappinessFromOccupiedCities(CvCity* pAssumeCityAnnexed, CvCit
 			iUnhappiness += iUnhappinessFromThisCity;
 		}
 	}
+#endif
 
 	// Handicap mod
 	iUnhappiness *= getHandicapInfo().getPopulationUnhappinessMod();
@@ -13088,6 +13357,9 @@ void CvPlayer::ChangeOccupiedPopulationUnhappinessMod(int iChange)
 	if(iChange != 0)
 	{
 		m_iOccupiedPopulationUnhappinessMod += iChange;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+		InvalidateCityUnhappinessTerms();
+#endif
 	}
 }
 
@@ -13105,6 +13377,9 @@ void CvPlayer::ChangeCapitalUnhappinessMod(int iChange)
 	if(iChange != 0)
 	{
 		m_iCapitalUnhappinessMod += iChange;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+		InvalidateCityUnhappinessTerms();
+#endif
 	}
 }
 
@@ -13527,7 +13802,11 @@ void CvPlayer::doAdoptPolicy(PolicyTypes ePolicy)
 
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerAdoptPolicy"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -14321,7 +14600,11 @@ void CvPlayer::changeGreatGeneralRateModFromBldgs(int ichange)
 void CvPlayer::DoUnitKilledCombat(PlayerTypes eKilledPlayer, UnitTypes eUnitType)
 {
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("UnitKilledInCombat"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -14393,7 +14676,11 @@ void CvPlayer::DoGreatPersonExpended(UnitTypes eGreatPersonUnit)
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("GreatPersonExpended"))
+#else
 	if (pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -15537,6 +15824,9 @@ void CvPlayer::changeHalfSpecialistUnhappinessCount(int iChange)
 	if(iChange != 0)
 	{
 		m_iHalfSpecialistUnhappinessCount = (m_iHalfSpecialistUnhappinessCount + iChange);
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+		InvalidateCityUnhappinessTerms();
+#endif
 		CvAssert(getHalfSpecialistUnhappinessCount() >= 0);
 	}
 }
@@ -16054,6 +16344,9 @@ void CvPlayer::setCapitalCity(CvCity* pNewCapitalCity)
 			}
 
 			m_iCapitalCityID = pNewCapitalCity->GetID();
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+			InvalidateCityUnhappinessTerms();
+#endif
 
 			pNewCapitalCity->SetEverCapital(true);
 #ifdef AUI_PLAYER_FIX_VENICE_ONLY_BANS_SETTLERS_NOT_SETTLING
@@ -16064,6 +16357,9 @@ void CvPlayer::setCapitalCity(CvCity* pNewCapitalCity)
 		else
 		{
 			m_iCapitalCityID = FFreeList::INVALID_INDEX;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+			InvalidateCityUnhappinessTerms();
+#endif
 		}
 	}
 }
@@ -18753,6 +19049,14 @@ void CvPlayer::DoUpdateProximityToPlayer(PlayerTypes ePlayer)
 	CvAssertMsg(ePlayer >= 0, "eIndex is expected to be non-negative (invalid Index)");
 	CvAssertMsg(ePlayer < MAX_PLAYERS, "eIndex is expected to be within maximum bounds (invalid Index)");
 
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	int iSmallestDistanceBetweenCities;
+	int iAverageDistanceBetweenCities;
+	int iNumCityConnections;
+
+	// Both directions of a pair share one scan, which is only redone after either player gains or loses a city
+	GC.getGame().GetCityDistancesBetweenPlayers(GetID(), ePlayer, iSmallestDistanceBetweenCities, iAverageDistanceBetweenCities, iNumCityConnections);
+#else
 	int iSmallestDistanceBetweenCities = GC.getMap().numPlots();
 	int iAverageDistanceBetweenCities = 0;
 
@@ -18789,6 +19093,7 @@ void CvPlayer::DoUpdateProximityToPlayer(PlayerTypes ePlayer)
 			iAverageDistanceBetweenCities += iTempDistance;
 		}
 	}
+#endif
 
 	// Seed this value with something reasonable to start.  This will be the value assigned if one player has 0 Cities.
 	PlayerProximityTypes eProximity = NO_PLAYER_PROXIMITY;
@@ -20845,6 +21150,12 @@ const CvCity* CvPlayer::getCity(int iID) const
 //	--------------------------------------------------------------------------------
 CvCity* CvPlayer::addCity()
 {
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	InvalidateCityUnhappinessTerms();
+#endif
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	GC.getGame().InvalidatePlayerCityLayout(GetID());
+#endif
 	return(m_cities.Add());
 }
 
@@ -20852,6 +21163,12 @@ CvCity* CvPlayer::addCity()
 void CvPlayer::deleteCity(int iID)
 {
 	m_cities.RemoveAt(iID);
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	InvalidateCityUnhappinessTerms();
+#endif
+#ifdef AUI_GAME_SHARED_CIV_PAIR_METRICS
+	GC.getGame().InvalidatePlayerCityLayout(GetID());
+#endif
 }
 
 //	--------------------------------------------------------------------------------
@@ -23742,6 +24059,9 @@ void CvPlayer::Read(FDataStream& kStream)
 	kStream >> m_iExtraHappinessPerLuxury;
 	kStream >> m_iUnhappinessFromUnits;
 	kStream >> m_iUnhappinessFromUnitsMod;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	m_bCityUnhappinessTermsDirty = true;
+#endif
 	kStream >> m_iUnhappinessMod;
 	kStream >> m_iCityCountUnhappinessMod;
 	kStream >> m_iOccupiedPopulationUnhappinessMod;
@@ -26762,7 +27082,11 @@ void CvPlayer::GatherPerTurnReplayStats(int iGameTurn)
 	cvStopWatch watch("Replay Stat Recording");
 #endif
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("GatherPerTurnReplayStats"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -513,6 +513,10 @@ public:
 	int GetUnhappinessFromOccupiedCities(CvCity* pAssumeCityAnnexed = NULL, CvCity* pAssumeCityPuppeted = NULL) const;
 #endif
 
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	void InvalidateCityUnhappinessTerms();
+#endif
+
 	int GetUnhappinessFromUnits() const;
 	void ChangeUnhappinessFromUnits(int iChange);
 
@@ -1705,6 +1709,21 @@ protected:
 	FAutoVariable<int, CvPlayer> m_iUprisingCounter;
 	FAutoVariable<int, CvPlayer> m_iExtraHappinessPerLuxury;
 	FAutoVariable<int, CvPlayer> m_iUnhappinessFromUnits;
+#ifdef AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+	enum CityUnhappinessTerms
+	{
+		CITY_UNHAPPINESS_CITY_COUNT,
+		CITY_UNHAPPINESS_CAPTURED_CITY_COUNT,
+		CITY_UNHAPPINESS_POPULATION,
+		CITY_UNHAPPINESS_SPECIALISTS,
+		CITY_UNHAPPINESS_OCCUPIED_POPULATION,
+		NUM_CITY_UNHAPPINESS_TERMS
+	};
+	void AddCityUnhappinessTerms(const CvCity* pCity, int* aiTerms, int iSign, const CvCity* pAssumeCityAnnexed = NULL, const CvCity* pAssumeCityPuppeted = NULL, const CvCity* pAssumeCityGrows = NULL, const CvCity* pAssumeCityExtraSpecialist = NULL) const;
+	void GetCityUnhappinessTerms(int* aiTerms, const CvCity* pAssumeCityAnnexed, const CvCity* pAssumeCityPuppeted, const CvCity* pAssumeCityGrows = NULL, const CvCity* pAssumeCityExtraSpecialist = NULL) const;
+	mutable int m_aiCityUnhappinessTerms[NUM_CITY_UNHAPPINESS_TERMS]; // not serialized, recounted after loading
+	mutable bool m_bCityUnhappinessTermsDirty;
+#endif
 	FAutoVariable<int, CvPlayer> m_iUnhappinessFromUnitsMod;
 	FAutoVariable<int, CvPlayer> m_iUnhappinessMod;
 	FAutoVariable<int, CvPlayer> m_iCityCountUnhappinessMod;
@@ -81,6 +81,11 @@ void CvPlayerAI::AI_uninit()
 void CvPlayerAI::AI_reset()
 {
 	AI_uninit();
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+	m_aiFoundValueInputs.clear();
+	m_uiFoundValueStamp = 0;
+	m_bFoundValuesValid = false;
+#endif
 }
 
 void CvPlayerAI::AI_doTurnPre()
@@ -182,19 +187,68 @@ void CvPlayerAI::AI_updateFoundValues(bool bStartingLoc)
 		{
 			GC.getMap().plotByIndexUnchecked(iI)->setFoundValue(eID, -1);
 		}
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+		m_bFoundValuesValid = false;
+#endif
 	}
 	else
 	{
 		const TeamTypes eTeam = getTeam();
 		GC.getGame().GetSettlerSiteEvaluator()->ComputeFlavorMultipliers(this);
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+		// Only plots within evaluation range (7) of a plot that changed since our last update can have a different value, unless our own inputs changed
+		std::vector<int> aiInputs;
+		GC.getGame().GetSettlerSiteEvaluator()->GetPlayerInputSignature(this, aiInputs);
+		const bool bFullUpdate = !m_bFoundValuesValid || aiInputs != m_aiFoundValueInputs;
+		std::vector<char> abDirty;
+		if (!bFullUpdate)
+		{
+			const int iRange = 7;
+			abDirty.resize(iNumPlots, 0);
+			for (int iI = 0; iI < iNumPlots; iI++)
+			{
+				CvPlot* pChangedPlot = GC.getMap().plotByIndexUnchecked(iI);
+				if (pChangedPlot->GetSiteChangeStamp() > m_uiFoundValueStamp)
+				{
+					for (int iDX = -iRange; iDX <= iRange; iDX++)
+					{
+						for (int iDY = -iRange; iDY <= iRange; iDY++)
+						{
+							CvPlot* pNearbyPlot = plotXYWithRangeCheck(pChangedPlot->getX(), pChangedPlot->getY(), iDX, iDY, iRange);
+							if (pNearbyPlot)
+							{
+								abDirty[GC.getMap().plotNum(pNearbyPlot->getX(), pNearbyPlot->getY())] = 1;
+							}
+						}
+					}
+				}
+			}
+		}
+		m_aiFoundValueInputs.swap(aiInputs);
+		m_uiFoundValueStamp = GC.getMap().GetPlotChangeStamp();
+		m_bFoundValuesValid = true;
+#endif
 		for (int iI = 0; iI < iNumPlots; iI++)
 		{
 			CvPlot* pLoopPlot = GC.getMap().plotByIndexUnchecked(iI);
 
 			if (pLoopPlot->isRevealed(eTeam))
 			{
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+				int iValue;
+				if (bFullUpdate || abDirty[iI])
+				{
+					iValue = GC.getGame().GetSettlerSiteEvaluator()->PlotFoundValue(pLoopPlot, this, NO_YIELD, false);
+					pLoopPlot->setFoundValue(eID, iValue);
+				}
+				else
+				{
+					iValue = pLoopPlot->getFoundValue(eID);
+				}
+#else
 				const int iValue = GC.getGame().GetSettlerSiteEvaluator()->PlotFoundValue(pLoopPlot, this, NO_YIELD, false);
 				pLoopPlot->setFoundValue(eID, iValue);
+#endif
 				if (iValue >= iGoodEnoughToBeWorthOurTime)
 				{
 					CvArea* pLoopArea = GC.getMap().getArea(pLoopPlot->getArea());
@@ -215,6 +269,8 @@ void CvPlayerAI::AI_updateFoundValues(bool bStartingLoc)
 //	---------------------------------------------------------------------------
 void CvPlayerAI::AI_unitUpdate()
 {
+	AI_PROFILE_SCOPE_PLAYER("CvPlayerAI::AI_unitUpdate", GetID());
+
 	GC.getPathFinder().ForceReset();
 	GC.getIgnoreUnitsPathFinder().ForceReset();
 	GC.getRouteFinder().ForceReset();
@@ -230,7 +286,11 @@ void CvPlayerAI::AI_unitUpdate()
 	bool bWaterRoutePathFinderMPCaching = GC.GetWaterRouteFinder().SetMPCacheSafe(true);
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerPreAIUnitUpdate"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -258,7 +318,10 @@ void CvPlayerAI::AI_unitUpdate()
 	else
 	{
 		// Update tactical AI
-		GetTacticalAI()->CommandeerUnits();
+		{
+			AI_PROFILE_SCOPE("CvTacticalAI::CommandeerUnits");
+			GetTacticalAI()->CommandeerUnits();
+		}
 
 		// Now let the tactical AI run.  Putting it after the operations update allows units who have
 		// just been handed off to the tactical AI to get a move in the same turn they switch between
@@ -710,6 +773,9 @@ void CvPlayerAI::Read(FDataStream& kStream)
 	// Version number to maintain backwards compatibility
 	uint uiVersion;
 	kStream >> uiVersion;
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+	m_bFoundValuesValid = false;
+#endif
 }
 
 
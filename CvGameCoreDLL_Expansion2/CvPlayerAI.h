@@ -103,6 +103,13 @@ protected:
 	static CvPlayerAI* m_aPlayers;
 
 	void AI_doResearch();
+
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+	// Not serialized; found values are fully recomputed on the first update after loading
+	std::vector<int> m_aiFoundValueInputs;
+	uint m_uiFoundValueStamp;
+	bool m_bFoundValuesValid;
+#endif
 };
 
 // helper for accessing static functions
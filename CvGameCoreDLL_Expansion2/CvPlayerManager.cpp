@@ -28,4 +28,44 @@ void CvPlayerManager::RefreshDangerPlots()
 		if(kPlayer.m_pDangerPlots && kPlayer.m_pDangerPlots->IsDirty())
 			kPlayer.UpdateDangerPlots();
 	}
-}
\ No newline at end of file
+}
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+
+//	-----------------------------------------------------------------------------------------------
+//	Throw away the incremental danger state of every player, eg. when a war or open borders change
+//	alters where units of uninvolved players can path
+// static
+void CvPlayerManager::InvalidateDangerPlots()
+{
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_PLAYERS; iPlayerLoop++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes) iPlayerLoop);
+		if(kPlayer.m_pDangerPlots)
+			kPlayer.m_pDangerPlots->SetFullRebuildNeeded();
+	}
+}
+
+//	-----------------------------------------------------------------------------------------------
+// static
+void CvPlayerManager::InvalidateUnitDanger(PlayerTypes eUnitOwner, int iUnitID)
+{
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_PLAYERS; iPlayerLoop++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes) iPlayerLoop);
+		if(kPlayer.m_pDangerPlots)
+			kPlayer.m_pDangerPlots->InvalidateUnitFootprint(eUnitOwner, iUnitID);
+	}
+}
+
+//	-----------------------------------------------------------------------------------------------
+// static
+void CvPlayerManager::InvalidateTeamUnitDanger(TeamTypes eTeam)
+{
+	for(int iPlayerLoop = 0; iPlayerLoop < MAX_PLAYERS; iPlayerLoop++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes) iPlayerLoop);
+		if(kPlayer.m_pDangerPlots)
+			kPlayer.m_pDangerPlots->InvalidateTeamUnitFootprints(eTeam);
+	}
+}
+#endif
\ No newline at end of file
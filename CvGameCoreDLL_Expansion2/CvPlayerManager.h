@@ -19,5 +19,16 @@ public:
 
 	//	Refresh all danger plots for players that have dirty danger plot structures.
 	static	void	RefreshDangerPlots();
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+
+	//	Make every player's next danger plot update start from scratch, for changes plot stamps can't catch.
+	static	void	InvalidateDangerPlots();
+
+	//	A unit's reach changed in a way plot stamps can't see (eg. a promotion), so every player has to recompute its danger.
+	static	void	InvalidateUnitDanger(PlayerTypes eUnitOwner, int iUnitID);
+
+	//	Same, for every unit of a team (eg. a tech granting embarkation, ocean passage or extra moves).
+	static	void	InvalidateTeamUnitDanger(TeamTypes eTeam);
+#endif
 };
 #endif
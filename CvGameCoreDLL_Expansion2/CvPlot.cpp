@@ -223,6 +223,12 @@ void CvPlot::reset(int iX, int iY, bool bConstructorCall)
 	m_cContinentType = 0;
 
 	m_uiTradeRouteBitFlags = 0;
+#ifdef AUI_PLOT_CHANGE_STAMPS
+	m_uiChangeStamp = 0;
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+	m_uiSiteChangeStamp = 0;
+#endif
+#endif
 
 	m_bStartingPlot = false;
 	m_bHills = false;
@@ -1406,10 +1412,308 @@ void CvPlot::changeSeeFromSight(TeamTypes eTeam, DirectionTypes eDirection, int
 	}
 }
 
+#ifdef AUI_PLOT_SIGHT_TEMPLATES
+//	--------------------------------------------------------------------------------
+// One step of the ring walk changeAdjacentSight() does, with everything that only depends on the offset from the center worked out up front
+struct CvSightTemplateEntry
+{
+	int iDX;
+	int iDY;
+	int iRing;
+	// Hex-space offsets of the two inward plots, only valid if the plot is on the previous ring
+	bool bFirstInwardValid;
+	bool bSecondInwardValid;
+	int iFirstInwardDX;
+	int iFirstInwardDY;
+	int iSecondInwardDX;
+	int iSecondInwardDY;
+	// 1 if the line of sight passes clearly closer to the first inward plot, 2 if to the second, 0 if it passes between them
+	int iCloserInward;
+	// Bit (1 << eFacingDirection) is set if shouldProcessDisplacementPlot() accepts this offset for that facing
+	uint uiFacingMask;
+};
+typedef std::vector<CvSightTemplateEntry> CvSightTemplate;
+
+// Indexed by range * 2 + the row parity of the center, since the tie-breaks use offset (not hex-space) coordinates
+static std::vector<CvSightTemplate> s_aSightTemplates;
+
+static double GetSightLineX(int iX, int iY)
+{
+	return (double)iX + ((iY & 1) ? 0.5 : 0.0);
+}
+
+static const CvSightTemplate& GetSightTemplate(const CvPlot& kCenter, int iRange)
+{
+	const uint uiIndex = uint(iRange) * 2 + uint(kCenter.getY() & 1);
+	if (uiIndex >= s_aSightTemplates.size())
+		s_aSightTemplates.resize(uiIndex + 1);
+	CvSightTemplate& kTemplate = s_aSightTemplates[uiIndex];
+	if (!kTemplate.empty())
+		return kTemplate;
+
+	const int iRangeWithOneExtraRing = iRange + 1;
+	// Lay the walk out around a stand-in center with the same row parity, far enough from the origin that nothing goes negative
+	const int iCenterY = 2 * (iRangeWithOneExtraRing + 1) + (kCenter.getY() & 1);
+	const int iCenterX = iCenterY;
+	const int iCenterHexX = xToHexspaceX(iCenterX, iCenterY);
+	const double fP0X = GetSightLineX(iCenterX, iCenterY);
+	const double fP0Y = (double)iCenterY;
+
+	// Same walk as the loop in changeAdjacentSight(), so the inward plots of every entry have been visited before it
+	int thisRing = 0;
+	DirectionTypes eDirectionOfNextTileToCheck = DIRECTION_NORTHWEST;
+	int iDX = 0;
+	int iDY = 0;
+	int iPlotCounter = 0;
+	int iMaxPlotNumberOnThisRing = 0;
+	while (thisRing <= iRangeWithOneExtraRing)
+	{
+		CvSightTemplateEntry kEntry;
+		kEntry.iDX = iDX;
+		kEntry.iDY = iDY;
+		kEntry.iRing = thisRing;
+		kEntry.bFirstInwardValid = false;
+		kEntry.bSecondInwardValid = false;
+		kEntry.iFirstInwardDX = 0;
+		kEntry.iFirstInwardDY = 0;
+		kEntry.iSecondInwardDX = 0;
+		kEntry.iSecondInwardDY = 0;
+		kEntry.iCloserInward = 0;
+		kEntry.uiFacingMask = 0;
+
+		for (int iI = 0; iI < NUM_DIRECTION_TYPES; iI++)
+		{
+			if (kCenter.shouldProcessDisplacementPlot(iDX, iDY, iRange, (DirectionTypes)iI))
+				kEntry.uiFacingMask |= (1 << iI);
+		}
+
+		if (thisRing != 0)
+		{
+			DirectionTypes eFirstInwardDirection = DIRECTION_EAST;
+			DirectionTypes eSecondInwardDirection = DIRECTION_NORTHEAST;
+			switch (eDirectionOfNextTileToCheck)
+			{
+			case DIRECTION_NORTHEAST:
+				eFirstInwardDirection = DIRECTION_EAST;
+				eSecondInwardDirection = DIRECTION_SOUTHEAST;
+				break;
+			case DIRECTION_EAST:
+				eFirstInwardDirection = DIRECTION_SOUTHWEST;
+				eSecondInwardDirection = DIRECTION_SOUTHEAST;
+				break;
+			case DIRECTION_SOUTHEAST:
+				eFirstInwardDirection = DIRECTION_SOUTHWEST;
+				eSecondInwardDirection = DIRECTION_WEST;
+				break;
+			case DIRECTION_SOUTHWEST:
+				eFirstInwardDirection = DIRECTION_WEST;
+				eSecondInwardDirection = DIRECTION_NORTHWEST;
+				break;
+			case DIRECTION_WEST:
+				eFirstInwardDirection = DIRECTION_NORTHWEST;
+				eSecondInwardDirection = DIRECTION_NORTHEAST;
+				break;
+			case DIRECTION_NORTHWEST:
+				eFirstInwardDirection = DIRECTION_EAST;
+				eSecondInwardDirection = DIRECTION_NORTHEAST;
+				break;
+			}
+			kEntry.iFirstInwardDX = iDX + GC.getPlotDirectionX()[eFirstInwardDirection];
+			kEntry.iFirstInwardDY = iDY + GC.getPlotDirectionY()[eFirstInwardDirection];
+			kEntry.bFirstInwardValid = (hexDistance(kEntry.iFirstInwardDX, kEntry.iFirstInwardDY) == thisRing - 1);
+			kEntry.iSecondInwardDX = iDX + GC.getPlotDirectionX()[eSecondInwardDirection];
+			kEntry.iSecondInwardDY = iDY + GC.getPlotDirectionY()[eSecondInwardDirection];
+			kEntry.bSecondInwardValid = (hexDistance(kEntry.iSecondInwardDX, kEntry.iSecondInwardDY) == thisRing - 1);
+
+			if (kEntry.bFirstInwardValid && kEntry.bSecondInwardValid)
+			{
+				const int iP1Y = iCenterY + iDY;
+				const double fP1X = GetSightLineX(hexspaceXToX(iCenterHexX + iDX, iP1Y), iP1Y);
+				const double fP1Y = (double)iP1Y;
+
+				double a = fP1Y - fP0Y;
+				double b = fP0X - fP1X;
+				double c = fP0Y * fP1X - fP1Y * fP0X;
+
+				const int iFirstInwardY = iCenterY + kEntry.iFirstInwardDY;
+				double fFirstDist = a * GetSightLineX(hexspaceXToX(iCenterHexX + kEntry.iFirstInwardDX, iFirstInwardY), iFirstInwardY) + b * (double)iFirstInwardY + c;
+				fFirstDist = abs(fFirstDist);
+				const int iSecondInwardY = iCenterY + kEntry.iSecondInwardDY;
+				double fSecondDist = a * GetSightLineX(hexspaceXToX(iCenterHexX + kEntry.iSecondInwardDX, iSecondInwardY), iSecondInwardY) + b * (double)iSecondInwardY + c;
+				fSecondDist = abs(fSecondDist);
+
+				if (fFirstDist - fSecondDist > 0.05)
+					kEntry.iCloserInward = 2;
+				else if (fSecondDist - fFirstDist > 0.05)
+					kEntry.iCloserInward = 1;
+			}
+		}
+
+		kTemplate.push_back(kEntry);
+
+		int iNextDX;
+		int iNextDY;
+		if (iPlotCounter >= iMaxPlotNumberOnThisRing)
+		{
+			eDirectionOfNextTileToCheck = DIRECTION_NORTHEAST;
+			iNextDX = iDX + GC.getPlotDirectionX()[eDirectionOfNextTileToCheck];
+			iNextDY = iDY + GC.getPlotDirectionY()[eDirectionOfNextTileToCheck];
+			thisRing++;
+			iMaxPlotNumberOnThisRing += thisRing * 6;
+			eDirectionOfNextTileToCheck = DIRECTION_EAST;
+		}
+		else
+		{
+			iNextDX = iDX + GC.getPlotDirectionX()[eDirectionOfNextTileToCheck];
+			iNextDY = iDY + GC.getPlotDirectionY()[eDirectionOfNextTileToCheck];
+			if (hexDistance(iNextDX, iNextDY) > thisRing)
+			{
+				eDirectionOfNextTileToCheck = GC.getTurnRightDirection(eDirectionOfNextTileToCheck);
+				iNextDX = iDX + GC.getPlotDirectionX()[eDirectionOfNextTileToCheck];
+				iNextDY = iDY + GC.getPlotDirectionY()[eDirectionOfNextTileToCheck];
+			}
+		}
+
+		iPlotCounter++;
+
+		iDX = iNextDX;
+		iDY = iNextDY;
+	}
+
+	return kTemplate;
+}
+
+//	--------------------------------------------------------------------------------
+// Same results as the full walk in changeAdjacentSight(); returns false without doing anything if the footprint crosses a wrap seam,
+// since the original tie-breaks use raw plot coordinates there and the template can't reproduce them
+bool CvPlot::changeAdjacentSightFromTemplate(TeamTypes eTeam, int iRange, bool bIncrement, InvisibleTypes eSeeInvisible, DirectionTypes eFacingDirection, bool bBasedOnUnit)
+{
+	const int iRangeWithOneExtraRing = iRange + 1;
+	const CvMap& kMap = GC.getMap();
+	if (kMap.isWrapX() && (getX() - 2 * iRangeWithOneExtraRing < 0 || getX() + 2 * iRangeWithOneExtraRing >= (int)kMap.getGridWidth()))
+		return false;
+	if (kMap.isWrapY() && (getY() - iRangeWithOneExtraRing < 0 || getY() + iRangeWithOneExtraRing >= (int)kMap.getGridHeight()))
+		return false;
+
+	const int INVALID_RING = -1;
+	const int HALF_BLOCKED = 0x01000000;
+	const CvSightTemplate& kTemplate = GetSightTemplate(*this, iRange);
+	const int iCenterLevel = seeFromLevel(eTeam);
+	const int iChange = (bIncrement ? 1 : -1);
+
+	for (CvSightTemplate::const_iterator it = kTemplate.begin(); it != kTemplate.end(); ++it)
+	{
+		const CvSightTemplateEntry& kEntry = *it;
+		CvPlot* pPlotToCheck = plotXY(getX(), getY(), kEntry.iDX, kEntry.iDY);
+		if (!pPlotToCheck)
+			continue;
+
+		//always reveal adjacent plots when using line of sight - but then clear it out
+		if (kEntry.iRing <= 1 && eFacingDirection != NO_DIRECTION)
+		{
+			pPlotToCheck->changeVisibilityCount(eTeam, 1, eSeeInvisible, false /*bInformExplorationTracking*/, false);
+			pPlotToCheck->changeVisibilityCount(eTeam, -1, eSeeInvisible, false /*bInformExplorationTracking*/, false);
+		}
+
+		// see if this plot is in the visibility wedge
+		if (eFacingDirection != NO_DIRECTION && !(kEntry.uiFacingMask & (1 << eFacingDirection)))
+			continue;
+
+		if (kEntry.iRing == 0)
+		{
+			pPlotToCheck->changeVisibilityCount(eTeam, iChange, eSeeInvisible, true, bBasedOnUnit ? true : false);
+			pPlotToCheck->setScratchPad(0);
+			continue;
+		}
+
+		int iFirstInwardLevel = INVALID_RING;
+		int iSecondInwardLevel = INVALID_RING;
+		bool bFirstHalfBlocked = false;
+		bool bSecondHalfBlocked = false;
+		if (kEntry.bFirstInwardValid)
+		{
+			CvPlot* pFirstInwardPlot = plotXY(getX(), getY(), kEntry.iFirstInwardDX, kEntry.iFirstInwardDY);
+			if (pFirstInwardPlot)
+			{
+				iFirstInwardLevel = pFirstInwardPlot->getScratchPad();
+				if (iFirstInwardLevel >= HALF_BLOCKED)
+				{
+					iFirstInwardLevel -= HALF_BLOCKED;
+					bFirstHalfBlocked = true;
+				}
+			}
+		}
+		if (kEntry.bSecondInwardValid)
+		{
+			CvPlot* pSecondInwardPlot = plotXY(getX(), getY(), kEntry.iSecondInwardDX, kEntry.iSecondInwardDY);
+			if (pSecondInwardPlot)
+			{
+				iSecondInwardLevel = pSecondInwardPlot->getScratchPad();
+				if (iSecondInwardLevel >= HALF_BLOCKED)
+				{
+					iSecondInwardLevel -= HALF_BLOCKED;
+					bSecondHalfBlocked = true;
+				}
+			}
+		}
+
+		const int iThisPlotLevel = pPlotToCheck->seeThroughLevel(kEntry.iRing != iRangeWithOneExtraRing);
+		// The inward level the line of sight has to pass over to get here
+		int iSightLevel = INVALID_RING;
+		if (iFirstInwardLevel != INVALID_RING && iSecondInwardLevel != INVALID_RING && iFirstInwardLevel != iSecondInwardLevel && !bFirstHalfBlocked && !bSecondHalfBlocked && kEntry.iCloserInward == 0)
+		{
+			// passes between both inward plots, so it is half blocked if only one of them blocks it
+			const int iHighestInwardLevel = (iFirstInwardLevel > iSecondInwardLevel) ? iFirstInwardLevel : iSecondInwardLevel;
+			iSightLevel = (iFirstInwardLevel > iSecondInwardLevel) ? iSecondInwardLevel : iFirstInwardLevel;
+			if (iHighestInwardLevel > iThisPlotLevel)
+			{
+				pPlotToCheck->setScratchPad(((iSightLevel > iThisPlotLevel) ? iSightLevel : iThisPlotLevel) + HALF_BLOCKED);
+			}
+			else
+			{
+				pPlotToCheck->setScratchPad(iThisPlotLevel);
+			}
+		}
+		else
+		{
+			if (iFirstInwardLevel != INVALID_RING && iSecondInwardLevel != INVALID_RING && iFirstInwardLevel != iSecondInwardLevel && !bFirstHalfBlocked && !bSecondHalfBlocked)
+				iSightLevel = (kEntry.iCloserInward == 1) ? iFirstInwardLevel : iSecondInwardLevel;
+			else if (iFirstInwardLevel != INVALID_RING && !bFirstHalfBlocked)
+				iSightLevel = iFirstInwardLevel;
+			else if (iSecondInwardLevel != INVALID_RING && !bSecondHalfBlocked)
+				iSightLevel = iSecondInwardLevel;
+			else if (iFirstInwardLevel != INVALID_RING)
+				iSightLevel = iFirstInwardLevel;
+			else if (iSecondInwardLevel != INVALID_RING)
+				iSightLevel = iSecondInwardLevel;
+
+			if (iSightLevel == INVALID_RING)
+			{
+				pPlotToCheck->setScratchPad(iThisPlotLevel);
+				continue;
+			}
+			pPlotToCheck->setScratchPad((iSightLevel > iThisPlotLevel) ? iSightLevel : iThisPlotLevel);
+		}
+
+		if (iSightLevel < iThisPlotLevel || ((iCenterLevel >= iSightLevel) && (kEntry.iRing < iRangeWithOneExtraRing)))
+		{
+			pPlotToCheck->changeVisibilityCount(eTeam, iChange, eSeeInvisible, true, (bBasedOnUnit && kEntry.iRing < 2) ? true : false);
+		}
+	}
+
+	return true;
+}
+
+#endif
 //	--------------------------------------------------------------------------------
 // while this looks more complex than the previous version, it should run much faster
 void CvPlot::changeAdjacentSight(TeamTypes eTeam, int iRange, bool bIncrement, InvisibleTypes eSeeInvisible, DirectionTypes eFacingDirection, bool bBasedOnUnit)
 {
+#ifdef AUI_PLOT_SIGHT_TEMPLATES
+	if (changeAdjacentSightFromTemplate(eTeam, iRange, bIncrement, eSeeInvisible, eFacingDirection, bBasedOnUnit))
+		return;
+
+#endif
 	//check one extra outer ring
 	int iRangeWithOneExtraRing = iRange + 1;
 
@@ -4515,6 +4819,9 @@ void CvPlot::setArea(int iNewValue)
 
 	if(getArea() != iNewValue)
 	{
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+		GC.getMap().NewStepPassabilityStamp();
+#endif
 		bOldLake = isLake();
 
 		if(area() != NULL)
@@ -5059,6 +5366,21 @@ void CvPlot::updatePotentialCityWork()
 	}
 }
 
+#ifdef AUI_PLOT_CHANGE_STAMPS
+//	--------------------------------------------------------------------------------
+/// Marks this plot as changed for caches built over its neighborhood (danger footprints, etc.)
+void CvPlot::StampChange(bool bAffectsSiteValue)
+{
+	m_uiChangeStamp = GC.getMap().NewPlotChangeStamp();
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+	if (bAffectsSiteValue)
+		m_uiSiteChangeStamp = m_uiChangeStamp;
+#else
+	DEBUG_VARIABLE(bAffectsSiteValue);
+#endif
+}
+#endif
+
 //	--------------------------------------------------------------------------------
 void CvPlot::setOwner(PlayerTypes eNewValue, int iAcquiringCityID, bool bCheckUnits, bool)
 {
@@ -5071,6 +5393,15 @@ void CvPlot::setOwner(PlayerTypes eNewValue, int iAcquiringCityID, bool bCheckUn
 	if(getOwner() != eNewValue)
 	{
 		PlayerTypes eOldOwner = getOwner();;
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+		GC.getMap().NewStepPassabilityStamp();
+#endif
 
 		GC.getGame().addReplayMessage(REPLAY_MESSAGE_PLOT_OWNER_CHANGE, eNewValue, "", getX(), getY());
 
@@ -5593,6 +5924,15 @@ void CvPlot::setPlotType(PlotTypes eNewValue, bool bRecalculate, bool bRebuildGr
 
 	if(getPlotType() != eNewValue)
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+		GC.getMap().NewStepPassabilityStamp();
+#endif
 		if((getPlotType() == PLOT_OCEAN) || (eNewValue == PLOT_OCEAN))
 		{
 			erase(bEraseUnitsIfWater);
@@ -5824,6 +6164,15 @@ void CvPlot::setTerrainType(TerrainTypes eNewValue, bool bRecalculate, bool bReb
 
 	if(getTerrainType() != eNewValue)
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+		GC.getMap().NewStepPassabilityStamp();
+#endif
 		if((getTerrainType() != NO_TERRAIN) &&
 		        (eNewValue != NO_TERRAIN) &&
 		        ((GC.getTerrainInfo(getTerrainType())->getSeeFromLevel() != GC.getTerrainInfo(eNewValue)->getSeeFromLevel()) ||
@@ -5873,6 +6222,15 @@ void CvPlot::setFeatureType(FeatureTypes eNewValue, int iVariety)
 
 	if((eOldFeature != eNewValue) || (m_iFeatureVariety != iVariety))
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+		GC.getMap().NewStepPassabilityStamp();
+#endif
 		if((eOldFeature == NO_FEATURE) ||
 		        (eNewValue == NO_FEATURE) ||
 		        (GC.getFeatureInfo(eOldFeature)->getSeeThroughChange() != GC.getFeatureInfo(eNewValue)->getSeeThroughChange()))
@@ -6032,6 +6390,9 @@ void CvPlot::setResourceType(ResourceTypes eNewValue, int iResourceNum, bool bFo
 			}
 		}
 
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+		StampChange();
+#endif
 		if(m_eResourceType != NO_RESOURCE)
 		{
 			if(area())
@@ -6235,6 +6596,12 @@ void CvPlot::setImprovementType(ImprovementTypes eNewValue, PlayerTypes eBuilder
 
 	if(eOldImprovement != eNewValue)
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
 #ifdef AUI_PLOT_FIX_PILLAGED_PLOT_ON_NEW_IMPROVEMENT
 		SetImprovementPillaged(false);
 #endif
@@ -6539,6 +6906,12 @@ void CvPlot::SetImprovementPillaged(bool bPillaged)
 
 	if(bPillaged != bWasPillaged)
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
 		m_bImprovementPillaged = bPillaged;
 		updateYield();
 
@@ -6681,6 +7054,12 @@ void CvPlot::setRouteType(RouteTypes eNewValue)
 
 	if(eOldRoute != eNewValue || (eOldRoute == eNewValue && IsRoutePillaged()))
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
 		bOldRoute = isRoute(); // XXX is this right???
 
 		// Remove old effects
@@ -6794,6 +7173,12 @@ void CvPlot::SetRoutePillaged(bool bPillaged)
 {
 	if(m_bRoutePillaged != bPillaged)
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
 		for(int iI = 0; iI < MAX_TEAMS; ++iI)
 		{
 #ifdef AUI_PLOT_OBSERVER_SEE_ALL_PLOTS
@@ -7028,6 +7413,12 @@ void CvPlot::setPlotCity(CvCity* pNewValue)
 
 	if(getPlotCity() != pNewValue)
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		GC.getMap().NewPathCostStamp();
+#endif
 		if(isCity())
 		{
 			// Is a route is here?  If so, we may now need to pay maintenance for it.  Yes, yes, I know, we're removing a city
@@ -8164,6 +8555,9 @@ PlotVisibilityChangeResult CvPlot::changeVisibilityCount(TeamTypes eTeam, int iC
 
 		if(bOldVisible != isVisible(eTeam))
 		{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+			StampChange(false);
+#endif
 			// We couldn't see the Plot before but we can now
 			if(isVisible(eTeam))
 			{
@@ -8541,6 +8935,9 @@ bool CvPlot::setRevealed(TeamTypes eTeam, bool bNewValue, bool bTerrainOnly, Tea
 	bool bVisbilityUpdated = false;
 	if(isRevealed(eTeam) != bNewValue)
 	{
+#ifdef AUI_PLOT_CHANGE_STAMPS
+		StampChange();
+#endif
 
 		m_bfRevealed.ToggleBit(eTeam);
 
@@ -8563,7 +8960,11 @@ bool CvPlot::setRevealed(TeamTypes eTeam, bool bNewValue, bool bTerrainOnly, Tea
 					int iNumNaturalWondersLeft = GC.getMap().GetNumNaturalWonders() - GET_TEAM(eTeam).GetNumNaturalWondersDiscovered();
 
 					ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+					if (pkScriptSystem && LuaSupport::HasGameEventListeners("NaturalWonderDiscovered"))
+#else
 					if (pkScriptSystem) 
+#endif
 					{
 						CvLuaArgsHandle args;
 						args->Push(eTeam);
@@ -9335,7 +9736,11 @@ bool CvPlot::changeBuildProgress(BuildTypes eBuild, int iChange, PlayerTypes ePl
 			bFinished = true;
 
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if(pkScriptSystem && LuaSupport::HasGameEventListeners("BuildFinished"))
+#else
 			if(pkScriptSystem)
+#endif
 			{
 				CvLuaArgsHandle args;
 				args->Push(ePlayer);
@@ -9647,6 +10052,9 @@ void CvPlot::addUnit(CvUnit* pUnit, bool bUpdate)
 		return;
 
 	CvAssertMsg(pUnit->at(getX(), getY()), "pUnit is expected to be at getX_INLINE and getY_INLINE");
+#ifdef AUI_PLOT_CHANGE_STAMPS
+	StampChange(false);
+#endif
 
 	IDInfo* pUnitNode = headUnitNode();
 	while(pUnitNode != NULL)
@@ -9696,6 +10104,9 @@ void CvPlot::removeUnit(CvUnit* pUnit, bool bUpdate)
 		{
 			CvAssertMsg(GetPlayerUnit(*pUnitNode)->at(getX(), getY()), "The current unit instance is expected to be at getX_INLINE and getY_INLINE");
 			m_units.deleteNode(pUnitNode);
+#ifdef AUI_PLOT_CHANGE_STAMPS
+			StampChange(false);
+#endif
 #ifdef AUI_CITIZENS_MID_TURN_ASSIGN_RUNS_SELF_CONSISTENCY
 			if (pUnit->getTeam() != getTeam() && getWorkingCity())
 				getWorkingCity()->GetCityCitizens()->DoSelfConsistencyCheck();
@@ -695,6 +695,20 @@ public:
 		m_iScratchPad = iNewValue;
 	}
 
+#ifdef AUI_PLOT_CHANGE_STAMPS
+	inline uint GetChangeStamp() const
+	{
+		return m_uiChangeStamp;
+	}
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+	inline uint GetSiteChangeStamp() const
+	{
+		return m_uiSiteChangeStamp;
+	}
+#endif
+	void StampChange(bool bAffectsSiteValue = true);
+#endif
+
 	PlayerTypes GetBuilderAIScratchPadPlayer() const;
 	void SetBuilderAIScratchPadPlayer(PlayerTypes ePlayer);
 
@@ -745,6 +759,10 @@ public:
 	bool HasWrittenArtifact() const;
 
 protected:
+#ifdef AUI_PLOT_SIGHT_TEMPLATES
+	bool changeAdjacentSightFromTemplate(TeamTypes eTeam, int iRange, bool bIncrement, InvisibleTypes eSeeInvisible, DirectionTypes eFacingDirection, bool bBasedOnUnit);
+#endif
+
 	class PlotBoolField
 	{
 	public:
@@ -867,6 +885,14 @@ protected:
 	// it will not be saved or loaded - you should assume that it is filled with garbage
 	// when you get it
 	int m_iScratchPad;
+#ifdef AUI_PLOT_CHANGE_STAMPS
+	// Not saved or loaded either; set from CvMap::NewPlotChangeStamp() whenever something that affects pathing, ownership or visibility changes here
+	uint m_uiChangeStamp;
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+	// Same, but only for changes that can affect the value of founding a city around here (ie. not unit movement or visibility)
+	uint m_uiSiteChangeStamp;
+#endif
+#endif
 #ifdef AUI_WARNING_FIXES
 	int m_cBuilderAIScratchPadPlayer;
 	int m_sBuilderAIScratchPadTurn;
@@ -16,6 +16,9 @@
 #include "CvGrandStrategyAI.h"
 #include "CvMilitaryAI.h"
 #include "cvStopWatch.h"
+#ifdef AUI_RELIGION_SPREAD_SPATIAL_INDEX
+#include "CvCityManager.h"
+#endif
 
 #include "LintFree.h"
  
@@ -285,6 +288,10 @@ FDataStream& operator<<(FDataStream& saveTo, const CvReligionInCity& readFrom)
 /// Constructor
 CvGameReligions::CvGameReligions(void):
 	m_iMinimumFaithForNextPantheon(0)
+#ifdef AUI_RELIGION_SPREAD_SPATIAL_INDEX
+	, m_bSpreadIndexBuilt(false)
+	, m_iSpreadIndexMaxDistance(0)
+#endif
 {
 }
 
@@ -311,6 +318,10 @@ void CvGameReligions::DoTurn()
 /// Spread religious pressure into adjacent cities
 void CvGameReligions::SpreadReligion()
 {
+#ifdef AUI_RELIGION_SPREAD_SPATIAL_INDEX
+	BuildSpreadIndex();
+
+#endif
 	// Loop through all the players
 	for(int iI = 0; iI < MAX_PLAYERS; iI++)
 	{
@@ -326,8 +337,91 @@ void CvGameReligions::SpreadReligion()
 			}
 		}
 	}
+#ifdef AUI_RELIGION_SPREAD_SPATIAL_INDEX
+
+	ClearSpreadIndex();
+#endif
 }
 
+#ifdef AUI_RELIGION_SPREAD_SPATIAL_INDEX
+/// Gathers what SpreadReligionToOneCity() needs to skip cities too far away to exert pressure
+void CvGameReligions::BuildSpreadIndex()
+{
+	// Largest adjacency range any founded religion can have
+	int iMaxDistanceMod = 0;
+	for(ReligionList::const_iterator it = m_CurrentReligions.begin(); it != m_CurrentReligions.end(); ++it)
+	{
+		if(it->m_eReligion > RELIGION_PANTHEON)
+		{
+			iMaxDistanceMod = max(iMaxDistanceMod, it->m_Beliefs.GetSpreadDistanceModifier());
+		}
+	}
+	m_iSpreadIndexMaxDistance = GC.getRELIGION_ADJACENT_CITY_DISTANCE();
+	if(iMaxDistanceMod > 0)
+	{
+		m_iSpreadIndexMaxDistance *= (100 + iMaxDistanceMod);
+		m_iSpreadIndexMaxDistance /= 100;
+	}
+
+	m_SpreadOrder.clear();
+	int iOrder = 0;
+	for(int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		CvPlayer& kPlayer = GET_PLAYER((PlayerTypes)iI);
+		if(kPlayer.isAlive())
+		{
+			int iLoop;
+			for(CvCity* pLoopCity = kPlayer.firstCity(&iLoop); pLoopCity != NULL; pLoopCity = kPlayer.nextCity(&iLoop))
+			{
+				m_SpreadOrder[pLoopCity] = iOrder++;
+			}
+		}
+	}
+
+	// Trade routes carry pressure regardless of distance, in both directions
+	m_SpreadTradePartners.clear();
+	CvGameTrade* pTrade = GC.getGame().GetGameTrade();
+	for(uint ui = 0; ui < pTrade->m_aTradeConnections.size(); ui++)
+	{
+		if(pTrade->IsTradeRouteIndexEmpty(ui))
+		{
+			continue;
+		}
+
+		const TradeConnection& kConnection = pTrade->m_aTradeConnections[ui];
+		CvPlot* pOriginPlot = GC.getMap().plot(kConnection.m_iOriginX, kConnection.m_iOriginY);
+		CvPlot* pDestPlot = GC.getMap().plot(kConnection.m_iDestX, kConnection.m_iDestY);
+		CvCity* pOriginCity = pOriginPlot ? pOriginPlot->getPlotCity() : NULL;
+		CvCity* pDestCity = pDestPlot ? pDestPlot->getPlotCity() : NULL;
+		if(!pOriginCity || !pDestCity)
+		{
+			continue;
+		}
+
+		std::vector<CvCity*>& aOriginPartners = m_SpreadTradePartners[pOriginCity];
+		if(std::find(aOriginPartners.begin(), aOriginPartners.end(), pDestCity) == aOriginPartners.end())
+		{
+			aOriginPartners.push_back(pDestCity);
+		}
+		std::vector<CvCity*>& aDestPartners = m_SpreadTradePartners[pDestCity];
+		if(std::find(aDestPartners.begin(), aDestPartners.end(), pOriginCity) == aDestPartners.end())
+		{
+			aDestPartners.push_back(pOriginCity);
+		}
+	}
+
+	m_bSpreadIndexBuilt = true;
+}
+
+/// Drops the spread index so SpreadReligionToOneCity() calls outside of SpreadReligion() use the full loop
+void CvGameReligions::ClearSpreadIndex()
+{
+	m_bSpreadIndexBuilt = false;
+	m_SpreadOrder.clear();
+	m_SpreadTradePartners.clear();
+}
+#endif
+
 /// Spread religious pressure to one city
 void CvGameReligions::SpreadReligionToOneCity(CvCity* pCity)
 {
@@ -344,6 +438,103 @@ void CvGameReligions::SpreadReligionToOneCity(CvCity* pCity)
 		pCity->GetCityReligions()->AddHolyCityPressure();
 	}
 
+#ifdef AUI_RELIGION_SPREAD_SPATIAL_INDEX
+	if(m_bSpreadIndexBuilt)
+	{
+		// Only cities in adjacency range or connected by trade can exert pressure; they get visited in the same order as the full loop below
+		std::vector< std::pair<int, CvCity*> > aSources;
+		std::map<CvCity*, int>::const_iterator itOrder;
+#ifdef AUI_CITY_MANAGER_GRID_INDEX
+		CvCityManager::CityList kNearbyCities;
+		CvCityManager::GetCitiesWithinRange(pCity->getX(), pCity->getY(), m_iSpreadIndexMaxDistance, kNearbyCities);
+		for(CvCityManager::CityList::const_iterator itNearby = kNearbyCities.begin(); itNearby != kNearbyCities.end(); ++itNearby)
+		{
+			CvCity* pLoopCity = *itNearby;
+			if(pLoopCity == pCity)
+			{
+				continue;
+			}
+#else
+		const CvCityManager::CityList& kNearbyCities = CvCityManager::GetNearbyCities(pCity);
+		for(CvCityManager::CityList::const_iterator itNearby = kNearbyCities.begin(); itNearby != kNearbyCities.end(); ++itNearby)
+		{
+			CvCity* pLoopCity = *itNearby;
+			// List is sorted by distance, so everything after this is out of range too
+			if(plotDistance(pCity->getX(), pCity->getY(), pLoopCity->getX(), pLoopCity->getY()) > m_iSpreadIndexMaxDistance)
+			{
+				break;
+			}
+#endif
+			itOrder = m_SpreadOrder.find(pLoopCity);
+			if(itOrder != m_SpreadOrder.end())
+			{
+				aSources.push_back(std::make_pair(itOrder->second, pLoopCity));
+			}
+		}
+		std::map< CvCity*, std::vector<CvCity*> >::const_iterator itPartners = m_SpreadTradePartners.find(pCity);
+		if(itPartners != m_SpreadTradePartners.end())
+		{
+			for(std::vector<CvCity*>::const_iterator itPartner = itPartners->second.begin(); itPartner != itPartners->second.end(); ++itPartner)
+			{
+				CvCity* pLoopCity = *itPartner;
+				// Partners in range were already added above
+				if(plotDistance(pCity->getX(), pCity->getY(), pLoopCity->getX(), pLoopCity->getY()) <= m_iSpreadIndexMaxDistance)
+				{
+					continue;
+				}
+				itOrder = m_SpreadOrder.find(pLoopCity);
+				if(itOrder != m_SpreadOrder.end())
+				{
+					aSources.push_back(std::make_pair(itOrder->second, pLoopCity));
+				}
+			}
+		}
+		std::sort(aSources.begin(), aSources.end());
+
+		uint uiSource = 0;
+		for(int iI = 0; iI < MAX_PLAYERS; iI++)
+		{
+			CvPlayer& kPlayer = GET_PLAYER((PlayerTypes)iI);
+			if(kPlayer.isAlive())
+			{
+				int iSpyPressure = kPlayer.GetReligions()->GetSpyPressure();
+				if (iSpyPressure > 0)
+				{
+					if (kPlayer.GetEspionage()->GetSpyIndexInCity(pCity) != -1)
+					{
+						ReligionTypes eReligionFounded = kPlayer.GetReligions()->GetReligionCreatedByPlayer();
+						pCity->GetCityReligions()->AddSpyPressure(eReligionFounded, iSpyPressure);
+					}
+				}
+
+				for(; uiSource < aSources.size() && aSources[uiSource].second->getOwner() == (PlayerTypes)iI; uiSource++)
+				{
+					CvCity* pLoopCity = aSources[uiSource].second;
+
+					// Does this city have a majority religion?
+					ReligionTypes eMajorityReligion = pLoopCity->GetCityReligions()->GetReligiousMajority();
+					if(eMajorityReligion == NO_RELIGION)
+					{
+						continue;
+					}
+
+					int iNumTradeRoutes = 0;
+					int iPressure = GetAdjacentCityReligiousPressure (eMajorityReligion, pLoopCity, pCity, iNumTradeRoutes, false);
+					if (iPressure > 0)
+					{
+						pCity->GetCityReligions()->AddReligiousPressure(FOLLOWER_CHANGE_ADJACENT_PRESSURE, eMajorityReligion, iPressure);
+						if (iNumTradeRoutes != 0)
+						{
+							pCity->GetCityReligions()->IncrementNumTradeRouteConnections(eMajorityReligion, iNumTradeRoutes);
+						}
+					}
+				}
+			}
+		}
+		return;
+	}
+
+#endif
 	// Loop through all the players
 	for(int iI = 0; iI < MAX_PLAYERS; iI++)
 	{
@@ -636,7 +827,11 @@ CvGameReligions::FOUNDING_RESULT CvGameReligions::CanCreatePantheon(PlayerTypes
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanFoundPantheon"))
+#else
 	if(pkScriptSystem) 
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(ePlayer);
@@ -670,7 +865,11 @@ ReligionTypes CvGameReligions::GetReligionToFound(PlayerTypes ePlayer)
 	eCivReligion = GET_PLAYER(ePlayer).getCivilizationInfo().GetReligion();
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("GetReligionToFound"))
+#else
 	if(pkScriptSystem) 
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(ePlayer);
@@ -792,7 +991,11 @@ void CvGameReligions::FoundPantheon(PlayerTypes ePlayer, BeliefTypes eBelief)
 	{
 #endif
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PantheonFounded"))
+#else
 	if(pkScriptSystem) 
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(ePlayer);
@@ -945,7 +1148,11 @@ void CvGameReligions::FoundReligion(PlayerTypes ePlayer, ReligionTypes eReligion
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("ReligionFounded"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(ePlayer);
@@ -1156,7 +1363,11 @@ void CvGameReligions::EnhanceReligion(PlayerTypes ePlayer, ReligionTypes eReligi
 #endif
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("ReligionEnhanced"))
+#else
 	if(pkScriptSystem) 
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(ePlayer);
@@ -1799,7 +2010,11 @@ ReligionTypes CvGameReligions::GetFounderBenefitsReligion(PlayerTypes ePlayer) c
 	ReligionTypes eReligion;
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("GetFounderBenefitsReligion"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(ePlayer);
@@ -4592,7 +4807,11 @@ void CvCityReligions::CityConvertsReligion(ReligionTypes eMajority, ReligionType
 		}
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if(pkScriptSystem && LuaSupport::HasGameEventListeners("CityConvertsReligion"))
+#else
 		if(pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(m_pCity->getOwner());
@@ -5607,7 +5826,11 @@ ReligionTypes CvReligionAI::GetReligionToSpread() const
 	ReligionTypes eRtnValue = NO_RELIGION;
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("GetReligionToSpread"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(m_pPlayer->GetID());
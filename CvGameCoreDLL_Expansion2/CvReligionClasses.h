@@ -267,7 +267,20 @@ private:
 	// Functions invoked each player turn
 	bool CheckSpawnGreatProphet(CvPlayer& kPlayer);
 
+#ifdef AUI_RELIGION_SPREAD_SPATIAL_INDEX
+	void BuildSpreadIndex();
+	void ClearSpreadIndex();
+#endif
+
 	int m_iMinimumFaithForNextPantheon;
+
+#ifdef AUI_RELIGION_SPREAD_SPATIAL_INDEX
+	// Only valid while SpreadReligion() runs
+	bool m_bSpreadIndexBuilt;
+	int m_iSpreadIndexMaxDistance;
+	std::map<CvCity*, int> m_SpreadOrder; // position of each city in the player/city loop of SpreadReligionToOneCity()
+	std::map< CvCity*, std::vector<CvCity*> > m_SpreadTradePartners;
+#endif
 };
 
 FDataStream& operator>>(FDataStream&, CvGameReligions&);
@@ -282,6 +282,44 @@ void CvCitySiteEvaluator::ComputeFlavorMultipliers(CvPlayer* pPlayer)
 	m_iFlavorMultiplier[SITE_EVALUATION_STRATEGIC] = 10;
 }
 
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+/// Everything about the player (rather than the map) that PlotFoundValue() depends on - call after ComputeFlavorMultipliers(); if two signatures match, found values computed with the first one are still valid for unchanged plots
+void CvCitySiteEvaluator::GetPlayerInputSignature(CvPlayer* pPlayer, std::vector<int>& aiSignature) const
+{
+	aiSignature.clear();
+	if (!pPlayer)
+		return;
+
+	for (int iI = 0; iI < NUM_SITE_EVALUATION_FACTORS; iI++)
+	{
+		aiSignature.push_back(m_iFlavorMultiplier[iI]);
+	}
+
+	aiSignature.push_back(pPlayer->isHuman() ? 1 : 0);
+	aiSignature.push_back(pPlayer->GetGrandStrategyAI()->GetPersonalityAndGrandStrategy((FlavorTypes)m_iNavalIndex));
+	aiSignature.push_back(pPlayer->GetGrandStrategyAI()->GetPersonalityAndGrandStrategy((FlavorTypes)m_iGrowthIndex));
+	aiSignature.push_back(pPlayer->GetGrandStrategyAI()->GetPersonalityAndGrandStrategy((FlavorTypes)m_iExpansionIndex));
+	aiSignature.push_back(pPlayer->GetDiplomacyAI()->GetBoldness());
+
+	// Capital area (offshore bonus) and cities per area (unique luxury trait)
+	const CvCity* pCapital = pPlayer->getCapitalCity();
+	aiSignature.push_back(pCapital ? pCapital->getArea() : -1);
+	aiSignature.push_back(pPlayer->getNumCities());
+
+	// Techs reveal resources and change nature yields
+	CvTeam& kTeam = GET_TEAM(pPlayer->getTeam());
+	aiSignature.push_back(kTeam.GetTeamTechs()->GetNumTechsKnown());
+	aiSignature.push_back(kTeam.GetCurrentEra());
+
+	// Resources the player lacks are worth more
+	const int iNumResources = GC.getNumResourceInfos();
+	for (int iI = 0; iI < iNumResources; iI++)
+	{
+		aiSignature.push_back(pPlayer->getNumResourceTotal((ResourceTypes)iI) == 0 ? 0 : 1);
+	}
+}
+#endif
+
 /// Retrieve the relative value of this plot (including plots that would be in city radius)
 int CvCitySiteEvaluator::PlotFoundValue(CvPlot* pPlot, CvPlayer* pPlayer, YieldTypes eYield, bool)
 {
@@ -36,6 +36,9 @@ public:
 
 	virtual void Init();
 	virtual void ComputeFlavorMultipliers(CvPlayer* pPlayer);
+#ifdef AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+	virtual void GetPlayerInputSignature(CvPlayer* pPlayer, std::vector<int>& aiSignature) const;
+#endif
 	virtual bool CanFound(CvPlot* pPlot, const CvPlayer* pPlayer, bool bTestVisible) const;
 	virtual int PlotFoundValue(CvPlot* pPlot, CvPlayer* pPlayer, YieldTypes eYield = NO_YIELD, bool bCoastOnly=true);
 	virtual int PlotFertilityValue(CvPlot* pPlot);
@@ -424,11 +424,18 @@ void CvTacticalAI::DoTurn()
 void CvTacticalAI::Update()
 {
 	AI_PERF_FORMAT("AI-perf.csv", ("Tactical AI, Turn %03d, %s", GC.getGame().getElapsedGameTurns(), m_pPlayer->getCivilizationShortDescription()) );
+	AI_PROFILE_SCOPE("CvTacticalAI::Update");
 
-	FindTacticalTargets();
+	{
+		AI_PROFILE_SCOPE("FindTacticalTargets");
+		FindTacticalTargets();
+	}
 
 	// Loop through each dominance zone assigning moves
-	ProcessDominanceZones();
+	{
+		AI_PROFILE_SCOPE("ProcessDominanceZones");
+		ProcessDominanceZones();
+	}
 }
 
 // TEMPORARY DOMINANCE ZONES
@@ -191,6 +191,13 @@ CvTacticalAnalysisMap::CvTacticalAnalysisMap(void) :
 	m_iTurnBuilt = -1;
 	m_bAtWar = false;
 	m_DominanceZones.clear();
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+	for(int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		m_auiPlayerSnapshotStamp[iI] = 0;
+		m_abPlayerSnapshotValid[iI] = false;
+	}
+#endif
 }
 
 /// Destructor
@@ -211,6 +218,13 @@ void CvTacticalAnalysisMap::Init(int iNumPlots)
 	}
 	m_pPlots = FNEW(CvTacticalAnalysisCell[iNumPlots], c_eCiv5GameplayDLL, 0);
 	m_iNumPlots = iNumPlots;
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+	for(int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		m_aPlayerCellSnapshots[iI].clear();
+	}
+	InvalidateCellSnapshots();
+#endif
 
 	m_iDominancePercentage = GC.getAI_TACTICAL_MAP_DOMINANCE_PERCENTAGE();
 }
@@ -243,6 +257,52 @@ void CvTacticalAnalysisMap::RefreshDataForNextPlayer(CvPlayer* pPlayer)
 
 				AddTemporaryZones();
 
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+				const int iPlayerID = m_pPlayer->GetID();
+				const bool bFullRebuild = !m_abPlayerSnapshotValid[iPlayerID] || (int)m_aPlayerCellSnapshots[iPlayerID].size() != m_iNumPlots;
+				if(bFullRebuild)
+				{
+					m_aPlayerCellSnapshots[iPlayerID].resize(m_iNumPlots);
+				}
+				const uint uiSnapshotStamp = m_auiPlayerSnapshotStamp[iPlayerID];
+				m_auiPlayerSnapshotStamp[iPlayerID] = GC.getMap().GetPlotChangeStamp();
+				m_abPlayerSnapshotValid[iPlayerID] = true;
+#endif
+
+#ifdef AUI_PARALLEL_AI_ANALYSIS
+				// Populating a cell only reads game state and writes to that cell (and its snapshot), so all cells can be filled in at once; dominance zones are shared, so they are built afterwards in plot order
+				const int iNumPlots = (int)GC.getMap().numPlots();
+				CvAssertMsg((iNumPlots <= m_iNumPlots), "Plot to be accessed exceeds allocation!");
+				m_abAddToZone.assign(iNumPlots, 0);
+#ifdef AUI_USE_OPENMP
+#pragma omp parallel for
+#endif
+				for(int iI = 0; iI < iNumPlots; iI++)
+				{
+					CvPlot* pPlot = GC.getMap().plotByIndexUnchecked(iI);
+					if(pPlot == NULL)
+					{
+						// Erase this cell
+						m_pPlots[iI].Clear();
+					}
+					else
+					{
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+						m_abAddToZone[iI] = RefreshCell(iI, pPlot, bFullRebuild, uiSnapshotStamp);
+#else
+						m_abAddToZone[iI] = PopulateCell(iI, pPlot);
+#endif
+					}
+				}
+
+				for(int iI = 0; iI < iNumPlots; iI++)
+				{
+					if(m_abAddToZone[iI])
+					{
+						AddToDominanceZones(iI, &m_pPlots[iI]);
+					}
+				}
+#else
 #ifdef AUI_WARNING_FIXES
 				for (uint iI = 0; iI < GC.getMap().numPlots(); iI++)
 #else
@@ -259,12 +319,17 @@ void CvTacticalAnalysisMap::RefreshDataForNextPlayer(CvPlayer* pPlayer)
 					}
 					else
 					{
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+						if(RefreshCell(iI, pPlot, bFullRebuild, uiSnapshotStamp))
+#else
 						if(PopulateCell(iI, pPlot))
+#endif
 						{
 							AddToDominanceZones(iI, &m_pPlots[iI]);
 						}
 					}
 				}
+#endif
 
 				CalculateMilitaryStrengths();
 				PrioritizeZones();
@@ -657,6 +722,39 @@ bool CvTacticalAnalysisMap::PopulateCell(int iIndex, CvPlot* pPlot)
 	return bAdd;
 }
 
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+/// Restores a cell from the current player's snapshot if its plot hasn't changed since, otherwise populates it again and updates the snapshot
+bool CvTacticalAnalysisMap::RefreshCell(int iIndex, CvPlot* pPlot, bool bFullRebuild, uint uiSnapshotStamp)
+{
+	CvTacticalAnalysisCell& kSnapshot = m_aPlayerCellSnapshots[m_pPlayer->GetID()][iIndex];
+	if(bFullRebuild || pPlot->GetChangeStamp() > uiSnapshotStamp)
+	{
+		bool bAdd = PopulateCell(iIndex, pPlot);
+		kSnapshot = m_pPlots[iIndex];
+		return bAdd;
+	}
+
+	CvTacticalAnalysisCell& cell = m_pPlots[iIndex];
+	cell = kSnapshot;
+
+	// Same check PopulateCell() ends with
+	if(cell.IsImpassableTerrain() || cell.IsImpassableTerritory() || !cell.IsRevealed())
+	{
+		return false;
+	}
+	return true;
+}
+
+/// Diplomatic changes alter cells without touching their plots, so every player's next refresh has to start over
+void CvTacticalAnalysisMap::InvalidateCellSnapshots()
+{
+	for(int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		m_abPlayerSnapshotValid[iI] = false;
+	}
+}
+#endif
+
 /// Add data for this cell into dominance zone information
 void CvTacticalAnalysisMap::AddToDominanceZones(int iIndex, CvTacticalAnalysisCell* pCell)
 {
@@ -657,6 +657,9 @@ public:
 	void ClearDynamicFlags();
 	void SetTargetBombardCells(CvPlot* pTarget, int iRange, bool bIgnoreLOS);
 	void SetTargetFlankBonusCells(CvPlot* pTarget);
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+	void InvalidateCellSnapshots();
+#endif
 
 	// Get the player the map was built for
 	CvPlayer* GetPlayer()
@@ -670,6 +673,9 @@ public:
 protected:
 	void AddTemporaryZones();
 	bool PopulateCell(int iIndex, CvPlot* pPlot);
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+	bool RefreshCell(int iIndex, CvPlot* pPlot, bool bFullRebuild, uint uiSnapshotStamp);
+#endif
 	void AddToDominanceZones(int iIndex, CvTacticalAnalysisCell* pCell);
 	void CalculateMilitaryStrengths();
 	void PrioritizeZones();
@@ -695,6 +701,15 @@ protected:
 	CvTacticalDominanceZone m_TempZone;
 	FStaticVector<CvTacticalDominanceZone, SAFE_ESTIMATE_NUM_DOMINANCE_ZONES, true, c_eCiv5GameplayDLL, 0> m_DominanceZones;
 	FStaticVector<CvUnit*, SAFE_ESTIMATE_NUM_ENEMIES, true, c_eCiv5GameplayDLL, 0> m_EnemyUnits;
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+	// Cells as PopulateCell() left them on each player's last refresh (not serialized, rebuilt after Init())
+	std::vector<CvTacticalAnalysisCell> m_aPlayerCellSnapshots[MAX_PLAYERS];
+	uint m_auiPlayerSnapshotStamp[MAX_PLAYERS];
+	bool m_abPlayerSnapshotValid[MAX_PLAYERS];
+#endif
+#ifdef AUI_PARALLEL_AI_ANALYSIS
+	std::vector<char> m_abAddToZone; // not vector<bool>, worker threads write to neighboring elements; kept between refreshes so it is only allocated once
+#endif
 };
 
 
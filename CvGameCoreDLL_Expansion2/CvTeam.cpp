@@ -417,6 +417,9 @@ void CvTeam::addTeam(TeamTypes eTeam)
 
 	CvAssert(eTeam != NO_TEAM);
 	CvAssert(eTeam != GetID());
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	GC.getMap().NewStepPassabilityStamp();
+#endif
 
 	for(iI = 0; iI < MAX_PLAYERS; iI++)
 	{
@@ -1107,7 +1110,11 @@ bool CvTeam::canDeclareWar(TeamTypes eTeam) const
 
 	// First, obtain the Lua script system.
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CanDeclareWar"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		// Construct and push in some event arguments.
 		CvLuaArgsHandle args(2);
@@ -1233,7 +1240,11 @@ void CvTeam::DoDeclareWar(TeamTypes eTeam, bool bDefensivePact, bool bMinorAllyP
 	GET_TEAM(eTeam).setAtWar(GetID(), true);
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("DeclareWar"))
+#else
 	if (pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(GetID());
@@ -1604,7 +1615,11 @@ void CvTeam::DoMakePeace(TeamTypes eTeam, bool bBumpUnits, bool bSuppressNotific
 		GET_TEAM(eTeam).setAtWar(GetID(), false);
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("MakePeace"))
+#else
 		if (pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(GetID());
@@ -1826,7 +1841,11 @@ void CvTeam::meet(TeamTypes eTeam, bool bSuppressMessages)
 		GET_TEAM(eTeam).makeHasMet(GetID(), bSuppressMessages);
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if(pkScriptSystem && LuaSupport::HasGameEventListeners("TeamMeet"))
+#else
 		if(pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args(2);
 			args->Push(eTeam);
@@ -3321,6 +3340,10 @@ void CvTeam::changeExtraMoves(DomainTypes eIndex, int iChange)
 	CvAssertMsg(eIndex < NUM_DOMAIN_TYPES, "eIndex is expected to be within maximum bounds (invalid Index)");
 	m_aiExtraMoves[eIndex] = (m_aiExtraMoves[eIndex] + iChange);
 	CvAssert(getExtraMoves(eIndex) >= 0);
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	if(iChange != 0)
+		CvPlayerManager::InvalidateTeamUnitDanger(GetID());
+#endif
 }
 
 
@@ -3342,6 +3365,9 @@ void CvTeam::changeCanEmbarkCount(int iChange)
 	if(iChange != 0)
 	{
 		m_iCanEmbarkCount += iChange;
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		CvPlayerManager::InvalidateTeamUnitDanger(GetID());
+#endif
 
 		if(canEmbark())
 		{
@@ -3478,6 +3504,12 @@ void CvTeam::changeEmbarkedAllWaterPassage(int iChange)
 	if(iChange != 0)
 	{
 		m_iEmbarkedAllWaterPassageCount += iChange;
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+		GC.getMap().NewStepPassabilityStamp();
+#endif
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		CvPlayerManager::InvalidateTeamUnitDanger(GetID());
+#endif
 	}
 	CvAssert(getEmbarkedAllWaterPassage() >= 0);
 }
@@ -3509,6 +3541,10 @@ int CvTeam::getEmbarkedExtraMoves() const
 void CvTeam::changeEmbarkedExtraMoves(int iChange)
 {
 	m_iEmbarkedExtraMoves = (m_iEmbarkedExtraMoves + iChange);
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+	if(iChange != 0)
+		CvPlayerManager::InvalidateTeamUnitDanger(GetID());
+#endif
 }
 
 
@@ -3762,6 +3798,24 @@ void CvTeam::setAtWar(TeamTypes eIndex, bool bNewValue)
 	CvAssertMsg(eIndex != GetID() || bNewValue == false, "Team is setting war with itself!");
 	if(eIndex != GetID() || bNewValue == false)
 		m_abAtWar[eIndex] = bNewValue;
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+
+	CvPlayerManager::InvalidateDangerPlots();
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+	GC.getMap().NewStepPassabilityStamp();
+#endif
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+	if(GC.getGame().GetTacticalAnalysisMap())
+		GC.getGame().GetTacticalAnalysisMap()->InvalidateCellSnapshots();
+#endif
+#ifdef AUI_ASTAR_REACHABILITY_MEMO
+	InvalidateReachabilityMemo();
+#endif
+#ifdef AUI_UNIT_CACHED_SURROUNDINGS_MODIFIERS
+	// Units cache enemy combat auras around them
+	GC.getMap().NewPlotChangeStamp();
+#endif
 
 	gDLL->GameplayWarStateChanged(GetID(), eIndex, bNewValue);
 
@@ -4122,6 +4176,19 @@ void CvTeam::SetAllowsOpenBordersToTeam(TeamTypes eIndex, bool bNewValue)
 	if(IsAllowsOpenBordersToTeam(eIndex) != bNewValue)
 	{
 		m_abOpenBorders[eIndex] = bNewValue;
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		CvPlayerManager::InvalidateDangerPlots();
+#endif
+#ifdef AUI_ASTAR_STEP_PATH_COMPONENTS
+		GC.getMap().NewStepPassabilityStamp();
+#endif
+#ifdef AUI_TACTICAL_MAP_PERSISTENT_CELLS
+		if(GC.getGame().GetTacticalAnalysisMap())
+			GC.getGame().GetTacticalAnalysisMap()->InvalidateCellSnapshots();
+#endif
+#ifdef AUI_ASTAR_REACHABILITY_MEMO
+		InvalidateReachabilityMemo();
+#endif
 
 		GC.getMap().verifyUnitValidPlot();
 
@@ -5364,6 +5431,10 @@ void CvTeam::setHasTech(TechTypes eIndex, bool bNewValue, PlayerTypes ePlayer, b
 	if(GetTeamTechs()->HasTech(eIndex) != bNewValue)
 	{
 		CvPlayerAI& kResearchingPlayer = GET_PLAYER(ePlayer);
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		// Techs can open up terrain (eg. ocean) for this team's units, which danger footprints don't see
+		CvPlayerManager::InvalidateTeamUnitDanger(GetID());
+#endif
 
 		if(	GC.getGame().getActivePlayer() == ePlayer &&
 			strcmp(pkTechInfo->GetType(), "TECH_SATELLITES") == 0 &&
@@ -6310,7 +6381,11 @@ void CvTeam::testCircumnavigated()
 					DLLUI->AddMessage(0, ((PlayerTypes)iI), false, GC.getEVENT_MESSAGE_TIME(), strBuffer);
 
 					ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+					if (pkScriptSystem && LuaSupport::HasGameEventListeners("CircumnavigatedGlobe"))
+#else
 					if (pkScriptSystem)
+#endif
 					{
 						CvLuaArgsHandle args;
 						args->Push(eTeamID);
@@ -6599,7 +6674,11 @@ void CvTeam::processTech(TechTypes eTech, int iChange)
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("TeamTechResearched"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args(3);
 		args->Push(GetID());
@@ -7042,7 +7121,11 @@ void CvTeam::SetCurrentEra(EraTypes eNewValue)
 		}
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if(pkScriptSystem && LuaSupport::HasGameEventListeners("TeamSetEra"))
+#else
 		if(pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(GetID());
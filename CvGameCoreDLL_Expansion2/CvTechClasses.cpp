@@ -1116,7 +1116,11 @@ bool CvPlayerTechs::CanEverResearch(TechTypes eTech) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanEverResearch"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(m_pPlayer->GetID());
@@ -1213,7 +1217,11 @@ bool CvPlayerTechs::CanResearch(TechTypes eTech, bool bTrade) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanResearch"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(m_pPlayer->GetID());
@@ -1924,7 +1932,11 @@ void CvTeamTechs::SetHasTech(TechTypes eIndex, bool bNewValue)
 			SetLastTechAcquired(eIndex);
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if(pkScriptSystem && LuaSupport::HasGameEventListeners("TeamSetHasTech"))
+#else
 		if(pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(m_pTeam->GetID());
@@ -35,6 +35,9 @@ CvGameTrade::CvGameTrade() : m_aaiTechDifference()
 CvGameTrade::CvGameTrade()
 #endif
 {
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	m_uiRevision = 1; // cities use 0 for "never counted"
+#endif
 	Reset();
 }
 
@@ -64,6 +67,12 @@ void CvGameTrade::Uninit (void)
 void CvGameTrade::Reset (void)
 {
 	m_aTradeConnections.clear();
+#ifdef AUI_TRADE_PLOT_INDEX
+	m_PlotConnectionIndex.clear();
+#endif
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	NewRevision();
+#endif
 	m_iNextID = 0;
 	m_CurrentTemporaryPopupRoute.iPlotX = 0;
 	m_CurrentTemporaryPopupRoute.iPlotY = 0;
@@ -375,6 +384,12 @@ bool CvGameTrade::CreateTradeRoute(CvCity* pOriginCity, CvCity* pDestCity, Domai
 	m_iNextID += 1;
 
 	CopyPathIntoTradeConnection(pPathfinderNode, &(m_aTradeConnections[iNewTradeRouteIndex]));
+#ifdef AUI_TRADE_PLOT_INDEX
+	AddConnectionToPlotIndex(iNewTradeRouteIndex);
+#endif
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	NewRevision();
+#endif
 
 	// reveal all plots to the player who created the trade route
 	TeamTypes eOriginTeam = GET_PLAYER(eOriginPlayer).getTeam();
@@ -1051,6 +1066,9 @@ bool CvGameTrade::EmptyTradeRoute(int iIndex)
 		}
 	}
 
+#ifdef AUI_TRADE_PLOT_INDEX
+	RemoveConnectionFromPlotIndex(iIndex);
+#endif
 	kTradeConnection.m_iID = -1;
 	kTradeConnection.m_iDestX = -1;
 	kTradeConnection.m_iDestY = -1;
@@ -1077,6 +1095,9 @@ bool CvGameTrade::EmptyTradeRoute(int iIndex)
 		kTradeConnection.m_aiOriginYields[ui] = 0;
 		kTradeConnection.m_aiDestYields[ui] = 0;
 	}
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	NewRevision();
+#endif
 
 	GET_PLAYER(eOriginPlayer).GetTrade()->UpdateTradeConnectionValues();
 	GET_PLAYER(eDestPlayer).GetTrade()->UpdateTradeConnectionValues();
@@ -1123,6 +1144,94 @@ bool CvGameTrade::IsTradeRouteIndexEmpty(const TradeConnectionList::const_iterat
 }
 #endif
 
+#ifdef AUI_TRADE_PLOT_INDEX
+//	--------------------------------------------------------------------------------
+/// Trade connections whose path goes through this plot, NULL if there are none
+const std::vector<uint>* CvGameTrade::GetConnectionsThroughPlot(const CvPlot* pPlot) const
+{
+	if (pPlot == NULL)
+	{
+		return NULL;
+	}
+
+	std::map< int, std::vector<uint> >::const_iterator it = m_PlotConnectionIndex.find((int)pPlot->GetPlotIndex());
+	if (it == m_PlotConnectionIndex.end() || it->second.empty())
+	{
+		return NULL;
+	}
+
+	return &(it->second);
+}
+
+//	--------------------------------------------------------------------------------
+/// Rebuilds the plot index from scratch (after loading)
+void CvGameTrade::RebuildPlotIndex()
+{
+	m_PlotConnectionIndex.clear();
+	for (uint ui = 0; ui < m_aTradeConnections.size(); ui++)
+	{
+		if (!IsTradeRouteIndexEmpty(ui))
+		{
+			AddConnectionToPlotIndex(ui);
+		}
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Registers every plot of a connection's path in the plot index
+void CvGameTrade::AddConnectionToPlotIndex(uint uiIndex)
+{
+	const TradeConnection& kTradeConnection = m_aTradeConnections[uiIndex];
+	for (uint ui = 0; ui < kTradeConnection.m_aPlotList.size(); ui++)
+	{
+		CvPlot* pPlot = GC.getMap().plot(kTradeConnection.m_aPlotList[ui].m_iX, kTradeConnection.m_aPlotList[ui].m_iY);
+		if (pPlot == NULL)
+		{
+			continue;
+		}
+
+		// Kept sorted so lookups visit connections in the same order as a scan of m_aTradeConnections would
+		std::vector<uint>& aiConnections = m_PlotConnectionIndex[(int)pPlot->GetPlotIndex()];
+		std::vector<uint>::iterator itInsert = std::lower_bound(aiConnections.begin(), aiConnections.end(), uiIndex);
+		if (itInsert == aiConnections.end() || *itInsert != uiIndex)
+		{
+			aiConnections.insert(itInsert, uiIndex);
+		}
+	}
+}
+
+//	--------------------------------------------------------------------------------
+/// Unregisters a connection's path from the plot index, must be called before the path is cleared
+void CvGameTrade::RemoveConnectionFromPlotIndex(uint uiIndex)
+{
+	const TradeConnection& kTradeConnection = m_aTradeConnections[uiIndex];
+	for (uint ui = 0; ui < kTradeConnection.m_aPlotList.size(); ui++)
+	{
+		CvPlot* pPlot = GC.getMap().plot(kTradeConnection.m_aPlotList[ui].m_iX, kTradeConnection.m_aPlotList[ui].m_iY);
+		if (pPlot == NULL)
+		{
+			continue;
+		}
+
+		std::map< int, std::vector<uint> >::iterator it = m_PlotConnectionIndex.find((int)pPlot->GetPlotIndex());
+		if (it == m_PlotConnectionIndex.end())
+		{
+			continue;
+		}
+
+		std::vector<uint>::iterator itEntry = std::lower_bound(it->second.begin(), it->second.end(), uiIndex);
+		if (itEntry != it->second.end() && *itEntry == uiIndex)
+		{
+			it->second.erase(itEntry);
+		}
+		if (it->second.empty())
+		{
+			m_PlotConnectionIndex.erase(it);
+		}
+	}
+}
+#endif
+
 //	--------------------------------------------------------------------------------
 /// Called when a city changes hands
 void CvGameTrade::ClearAllCityTradeRoutes (CvPlot* pPlot)
@@ -1394,6 +1503,10 @@ int CvGameTrade::GetNumTradeRoutesInPlot(const CvPlot* pPlot) const
 int CvGameTrade::GetNumTradeRoutesInPlot (CvPlot* pPlot)
 #endif
 {
+#ifdef AUI_TRADE_PLOT_INDEX
+	const std::vector<uint>* paiConnections = GetConnectionsThroughPlot(pPlot);
+	return paiConnections ? (int)paiConnections->size() : 0;
+#else
 	int iResult = 0;
 	int iX = pPlot->getX();
 	int iY = pPlot->getY();
@@ -1426,6 +1539,7 @@ int CvGameTrade::GetNumTradeRoutesInPlot (CvPlot* pPlot)
 	}
 
 	return iResult;
+#endif
 }
 
 //	--------------------------------------------------------------------------------
@@ -2133,6 +2247,13 @@ FDataStream& operator>>(FDataStream& loadFrom, CvGameTrade& writeTo)
 	}
 
 	loadFrom >> writeTo.m_iNextID;
+#ifdef AUI_TRADE_PLOT_INDEX
+
+	writeTo.RebuildPlotIndex();
+#endif
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	writeTo.NewRevision();
+#endif
 
 	return loadFrom;
 }
@@ -3048,6 +3169,10 @@ void CvPlayerTrade::UpdateTradeConnectionValues (void)
 			}
 		}
 	}
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+
+	pTrade->NewRevision();
+#endif
 }
 
 //	--------------------------------------------------------------------------------
@@ -3274,6 +3399,37 @@ bool CvPlayerTrade::CanCreateTradeRoute(DomainTypes eDomain)
 
 	int iCityLoop;
 	CvCity* pLoopCity;
+#ifdef AUI_CITY_MANAGER_GRID_INDEX
+	// Trade range is measured in path cost, not plots, so every city is a candidate; the answer doesn't depend on the order they're tried in, so walk the city index as it is instead of sorting it per city
+	const uint uiNumBuckets = CvCityManager::GetNumCityBuckets();
+	for(pLoopCity = m_pPlayer->firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = m_pPlayer->nextCity(&iCityLoop))
+	{
+		for (uint uiBucket = 0; uiBucket < uiNumBuckets; uiBucket++)
+		{
+			const CvCityManager::CityList& kBucket = CvCityManager::GetCityBucket(uiBucket);
+			for (CvCityManager::CityList::const_iterator itr = kBucket.begin(); itr != kBucket.end(); ++itr)
+			{
+				CvCity* pLoopCity2 = (*itr);
+				if (pLoopCity2 == pLoopCity)
+					continue;
+
+				for (uint uiConnectionTypes = 0; uiConnectionTypes < NUM_TRADE_CONNECTION_TYPES; uiConnectionTypes++)
+				{
+					// Check the route, but not the path
+					if (CanCreateTradeRoute(pLoopCity, pLoopCity2, eDomain, (TradeConnectionType)uiConnectionTypes, false, false))
+					{
+						// Check the path
+						if (pGameTrade->IsValidTradeRoutePath(pLoopCity, pLoopCity2, eDomain))
+							return true;
+
+						// else we can just break out of the loop
+						break;
+					}
+				}
+			}
+		}
+	}
+#else
 	for(pLoopCity = m_pPlayer->firstCity(&iCityLoop); pLoopCity != NULL; pLoopCity = m_pPlayer->nextCity(&iCityLoop))
 	{
 		// Get a sorted list of nearby cities 
@@ -3296,6 +3452,7 @@ bool CvPlayerTrade::CanCreateTradeRoute(DomainTypes eDomain)
 			}
 		}
 	}
+#endif
 
 	return false;
 
@@ -3566,6 +3723,10 @@ std::vector<int> CvPlayerTrade::GetTradeUnitsAtPlot(const CvPlot* pPlot, bool bF
 #endif
 {
 	std::vector<int> aiTradeConnectionIDs;
+#ifdef AUI_TRADE_PLOT_INDEX
+	FindTradeConnectionsAtPlot(pPlot, true, bExcludingMe, bOnlyWar, bFailAtFirstFound, &aiTradeConnectionIDs);
+	return aiTradeConnectionIDs;
+#else
 
 	if (pPlot == NULL)
 	{
@@ -3625,6 +3786,7 @@ std::vector<int> CvPlayerTrade::GetTradeUnitsAtPlot(const CvPlot* pPlot, bool bF
 	}
 
 	return aiTradeConnectionIDs;	
+#endif
 }
 
 
@@ -3636,6 +3798,10 @@ std::vector<int> CvPlayerTrade::GetTradePlotsAtPlot(const CvPlot* pPlot, bool bF
 #endif
 {
 	std::vector<int> aiTradeConnectionIDs;
+#ifdef AUI_TRADE_PLOT_INDEX
+	FindTradeConnectionsAtPlot(pPlot, false, bExcludingMe, bOnlyWar, bFailAtFirstFound, &aiTradeConnectionIDs);
+	return aiTradeConnectionIDs;
+#else
 
 	if (pPlot == NULL)
 	{
@@ -3709,7 +3875,65 @@ std::vector<int> CvPlayerTrade::GetTradePlotsAtPlot(const CvPlot* pPlot, bool bF
 	}
 
 	return aiTradeConnectionIDs;	
+#endif
+}
+
+#ifdef AUI_TRADE_PLOT_INDEX
+//	--------------------------------------------------------------------------------
+/// Counts (and optionally collects the IDs of) the trade connections through this plot that pass the team filters, using the game's plot index
+/// With bUnitsOnly, only connections whose trade unit currently stands on the plot are counted
+int CvPlayerTrade::FindTradeConnectionsAtPlot(const CvPlot* pPlot, bool bUnitsOnly, bool bExcludingMe, bool bOnlyWar, bool bFailAtFirstFound, std::vector<int>* paiTradeConnectionIDs) const
+{
+	CvGameTrade* pTrade = GC.getGame().GetGameTrade();
+	const std::vector<uint>* paiConnections = pTrade->GetConnectionsThroughPlot(pPlot);
+	if (paiConnections == NULL)
+	{
+		return 0;
+	}
+
+	int iX = pPlot->getX();
+	int iY = pPlot->getY();
+	TeamTypes eMyTeam = m_pPlayer->getTeam();
+
+	int iCount = 0;
+	for (std::vector<uint>::const_iterator it = paiConnections->begin(); it != paiConnections->end(); ++it)
+	{
+		const TradeConnection& kConnection = pTrade->m_aTradeConnections[*it];
+
+		TeamTypes eOtherTeam = GET_PLAYER(kConnection.m_eOriginOwner).getTeam();
+		if (bExcludingMe && eOtherTeam == eMyTeam)
+		{
+			continue;
+		}
+
+		if (bOnlyWar && !GET_TEAM(eMyTeam).isAtWar(eOtherTeam))
+		{
+			continue;
+		}
+
+		if (bUnitsOnly)
+		{
+			const TradeConnectionPlot& kUnitPlot = kConnection.m_aPlotList[kConnection.m_iTradeUnitLocationIndex];
+			if (kUnitPlot.m_iX != iX || kUnitPlot.m_iY != iY)
+			{
+				continue;
+			}
+		}
+
+		iCount++;
+		if (paiTradeConnectionIDs)
+		{
+			paiTradeConnectionIDs->push_back(kConnection.m_iID);
+		}
+		if (bFailAtFirstFound)
+		{
+			break;
+		}
+	}
+
+	return iCount;
 }
+#endif
 
 //	--------------------------------------------------------------------------------
 #ifdef AUI_CONSTIFY
@@ -3728,6 +3952,9 @@ bool CvPlayerTrade::ContainsOpposingPlayerTradeUnit(const CvPlot* pPlot) const
 bool CvPlayerTrade::ContainsOpposingPlayerTradeUnit(const CvPlot* pPlot)
 #endif
 {
+#ifdef AUI_TRADE_PLOT_INDEX
+	return FindTradeConnectionsAtPlot(pPlot, true, true, false, true, NULL) > 0;
+#else
 	std::vector<int> aiTradeConnectionIDs;
 	aiTradeConnectionIDs = GetOpposingTradeUnitsAtPlot(pPlot, true);
 	if (aiTradeConnectionIDs.size() > 0)
@@ -3738,6 +3965,7 @@ bool CvPlayerTrade::ContainsOpposingPlayerTradeUnit(const CvPlot* pPlot)
 	{
 		return false;
 	}
+#endif
 }
 
 //	--------------------------------------------------------------------------------
@@ -3757,6 +3985,9 @@ bool CvPlayerTrade::ContainsEnemyTradeUnit(const CvPlot* pPlot) const
 bool CvPlayerTrade::ContainsEnemyTradeUnit(const CvPlot* pPlot)
 #endif
 {
+#ifdef AUI_TRADE_PLOT_INDEX
+	return FindTradeConnectionsAtPlot(pPlot, true, true, true, true, NULL) > 0;
+#else
 	std::vector<int> aiTradeConnectionIDs;
 	aiTradeConnectionIDs = GetEnemyTradeUnitsAtPlot(pPlot, true);
 	if (aiTradeConnectionIDs.size() > 0)
@@ -3767,6 +3998,7 @@ bool CvPlayerTrade::ContainsEnemyTradeUnit(const CvPlot* pPlot)
 	{
 		return false;
 	}
+#endif
 }
 
 //	--------------------------------------------------------------------------------
@@ -3786,6 +4018,9 @@ bool CvPlayerTrade::ContainsEnemyTradePlot(const CvPlot* pPlot) const
 bool CvPlayerTrade::ContainsEnemyTradePlot(const CvPlot* pPlot)
 #endif
 {
+#ifdef AUI_TRADE_PLOT_INDEX
+	return FindTradeConnectionsAtPlot(pPlot, false, true, true, true, NULL) > 0;
+#else
 	std::vector<int> aiTradeConnectionIDs;
 	aiTradeConnectionIDs = GetEnemyTradePlotsAtPlot(pPlot, true);
 	if (aiTradeConnectionIDs.size() > 0)
@@ -3796,6 +4031,7 @@ bool CvPlayerTrade::ContainsEnemyTradePlot(const CvPlot* pPlot)
 	{
 		return false;
 	}
+#endif
 }
 
 //	--------------------------------------------------------------------------------
@@ -4491,6 +4727,18 @@ std::vector<CvString> CvPlayerTrade::GetPlotToolTips (CvPlot* pPlot)
 
 	Localization::String strResult;
 
+#ifdef AUI_TRADE_PLOT_INDEX
+	// only connections whose path goes through this plot can produce a tooltip
+	const std::vector<uint>* paiConnections = pTrade->GetConnectionsThroughPlot(pPlot);
+	if (paiConnections == NULL)
+	{
+		return aToolTips;
+	}
+
+	for (std::vector<uint>::const_iterator itConnection = paiConnections->begin(); itConnection != paiConnections->end(); ++itConnection)
+	{
+		TradeConnection* pConnection = &(pTrade->m_aTradeConnections[*itConnection]);
+#else
 #ifdef AUI_ITERATORIZE
 	for (TradeConnectionList::iterator pConnection = pTrade->m_aTradeConnections.begin(); pConnection != pTrade->m_aTradeConnections.end(); ++pConnection)
 	{
@@ -4506,6 +4754,7 @@ std::vector<CvString> CvPlayerTrade::GetPlotToolTips (CvPlot* pPlot)
 
 #ifndef AUI_ITERATORIZE
 		TradeConnection* pConnection = &(pTrade->m_aTradeConnections[uiConnection]);
+#endif
 #endif
 
 		bool bDisplayInfo = false;
@@ -4607,6 +4856,18 @@ std::vector<CvString> CvPlayerTrade::GetPlotMouseoverToolTips (CvPlot* pPlot)
 
 	Localization::String strResult;
 
+#ifdef AUI_TRADE_PLOT_INDEX
+	// only connections whose path goes through this plot can produce a tooltip
+	const std::vector<uint>* paiConnections = pTrade->GetConnectionsThroughPlot(pPlot);
+	if (paiConnections == NULL)
+	{
+		return aToolTips;
+	}
+
+	for (std::vector<uint>::const_iterator itConnection = paiConnections->begin(); itConnection != paiConnections->end(); ++itConnection)
+	{
+		TradeConnection* pConnection = &(pTrade->m_aTradeConnections[*itConnection]);
+#else
 #ifdef AUI_ITERATORIZE
 	for (TradeConnectionList::iterator pConnection = pTrade->m_aTradeConnections.begin(); pConnection != pTrade->m_aTradeConnections.end(); ++pConnection)
 	{
@@ -4622,6 +4883,7 @@ std::vector<CvString> CvPlayerTrade::GetPlotMouseoverToolTips (CvPlot* pPlot)
 
 #ifndef AUI_ITERATORIZE
 		TradeConnection* pConnection = &(pTrade->m_aTradeConnections[uiConnection]);
+#endif
 #endif
 
 		bool bDisplayInfo = false;
@@ -180,6 +180,23 @@ public:
 	static CvCity* GetOriginCity(const TradeConnection& kTradeConnection);
 	static CvCity* GetDestCity(const TradeConnection& kTradeConnection);
 
+#ifdef AUI_TRADE_PLOT_INDEX
+	const std::vector<uint>* GetConnectionsThroughPlot(const CvPlot* pPlot) const; // indices into m_aTradeConnections, ascending
+	void RebuildPlotIndex();
+	void AddConnectionToPlotIndex(uint uiIndex);
+	void RemoveConnectionFromPlotIndex(uint uiIndex);
+#endif
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	uint GetRevision() const
+	{
+		return m_uiRevision;
+	}
+	void NewRevision()
+	{
+		m_uiRevision++;
+	}
+#endif
+
 #ifdef AUI_YIELDS_APPLIED_AFTER_TURN_NOT_BEFORE
 	void ResetTechDifference(PlayerTypes eForPlayer = NO_PLAYER);
 	void BuildTechDifference(PlayerTypes eForPlayer = NO_PLAYER);
@@ -215,6 +232,12 @@ public:
 
 	TradeConnectionList m_aTradeConnections;
 	int m_iNextID; // used to assign IDs to trade routes to avoid confusion when some are disrupted in multiplayer
+#ifdef AUI_TRADE_PLOT_INDEX
+	std::map< int, std::vector<uint> > m_PlotConnectionIndex; // plot index -> connections through it, not serialized (rebuilt on load)
+#endif
+#ifdef AUI_CITY_CACHED_YIELD_RATES
+	uint m_uiRevision; // bumped whenever a connection or its yields change, not serialized (cities recount after loading)
+#endif
 
 	int m_aaiTechDifference[MAX_MAJOR_CIVS][MAX_MAJOR_CIVS];
 
@@ -343,6 +366,10 @@ public:
 	bool ContainsEnemyTradePlot(const CvPlot* pPlot);
 #endif
 
+#ifdef AUI_TRADE_PLOT_INDEX
+	int FindTradeConnectionsAtPlot(const CvPlot* pPlot, bool bUnitsOnly, bool bExcludingMe, bool bOnlyWar, bool bFailAtFirstFound, std::vector<int>* paiTradeConnectionIDs) const;
+#endif
+
 	bool PlunderTradeRoute(int iTradeConnectionID);
 
 #ifdef AUI_CONSTIFY
@@ -42,6 +42,9 @@
 #include "CvDllCity.h"
 #include "CvGameQueries.h"
 #include "CvBarbarians.h"
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+#include "CvPlayerManager.h"
+#endif
 
 #if !defined(FINAL_RELEASE)
 #include <sstream>
@@ -1063,6 +1066,15 @@ void CvUnit::reset(int iID, UnitTypes eUnit, PlayerTypes eOwner, bool bConstruct
 
 	m_kLastPath.clear();
 	m_uiLastPathCacheDest = (uint)-1;
+#ifdef AUI_UNIT_CACHED_SURROUNDINGS_MODIFIERS
+	m_uiSurroundingsCacheStamp = 0;
+	m_iSurroundingsCachePlot = -1;
+	m_bSurroundingsNearGreatGeneral = false;
+	m_bSurroundingsStackedGreatGeneral = false;
+	m_bSurroundingsFriendlyCombatUnitAdjacent = false;
+	m_iSurroundingsReverseGreatGeneralModifier = 0;
+	m_iSurroundingsNearbyImprovementModifier = 0;
+#endif
 
 	m_iMapLayer = DEFAULT_UNIT_MAP_LAYER;
 	m_iNumGoodyHutsPopped = 0;
@@ -1370,7 +1382,11 @@ void CvUnit::kill(bool bDelay, PlayerTypes ePlayer /*= NO_PLAYER*/)
 	CvString strBuffer;
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CanSaveUnit"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -1491,7 +1507,11 @@ void CvUnit::kill(bool bDelay, PlayerTypes ePlayer /*= NO_PLAYER*/)
 		}
 	}
 
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("UnitPrekill"))
+#else
 	if (pkScriptSystem) 
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(((int)getOwner()));
@@ -4404,7 +4424,11 @@ bool CvUnit::canLoad(const CvPlot& targetPlot) const
 				}
 
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if (pkScriptSystem && LuaSupport::HasGameEventListeners("CanLoadAt"))
+#else
 				if (pkScriptSystem)
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(getOwner());
@@ -6229,7 +6253,11 @@ bool CvUnit::canParadrop(const CvPlot* pPlot, bool bOnlyTestVisibility) const
 		{
 			// We're in friendly territory, call the event to see if we CAN'T start from here anyway
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if (pkScriptSystem && LuaSupport::HasGameEventListeners("CannotParadropFrom"))
+#else
 			if (pkScriptSystem) 
+#endif
 			{
 				CvLuaArgsHandle args;
 				args->Push(((int)getOwner()));
@@ -6253,7 +6281,11 @@ bool CvUnit::canParadrop(const CvPlot* pPlot, bool bOnlyTestVisibility) const
 		{
 			// We're not in friendly territory, call the event to see if we CAN start from here anyway
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if (pkScriptSystem && LuaSupport::HasGameEventListeners("CanParadropFrom")) {
+#else
 			if (pkScriptSystem) {
+#endif
 				CvLuaArgsHandle args;
 				args->Push(((int)getOwner()));
 				args->Push(GetID());
@@ -6347,7 +6379,11 @@ bool CvUnit::paradrop(int iX, int iY)
 	setXY(pPlot->getX(), pPlot->getY(), true, true, false);
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("ParadropAt"))
+#else
 	if (pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(((int)getOwner()));
@@ -7092,7 +7128,11 @@ bool CvUnit::canRebaseAt(const CvPlot* pPlot, int iX, int iY) const
 		if (!bCityToRebase)
 		{
 			ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+			if (pkScriptSystem && LuaSupport::HasGameEventListeners("CanRebaseInCity"))
+#else
 			if (pkScriptSystem)
+#endif
 			{
 				CvLuaArgsHandle args;
 				args->Push(getOwner());
@@ -7148,7 +7188,11 @@ bool CvUnit::canRebaseAt(const CvPlot* pPlot, int iX, int iY) const
 	if(!bCityToRebase && !bUnitToRebase)
 	{
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("CanRebaseTo"))
+#else
 		if (pkScriptSystem) 
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(getOwner());
@@ -7212,7 +7256,11 @@ bool CvUnit::rebase(int iX, int iY)
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("RebaseTo"))
+#else
 	if (pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -7706,7 +7754,11 @@ bool CvUnit::CanFoundReligion(const CvPlot* pPlot) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("PlayerCanFoundReligion"))
+#else
 	if (pkScriptSystem) 
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -10001,7 +10053,11 @@ void CvUnit::promote(PromotionTypes ePromotion, int iLeaderUnitId)
 		setHasPromotion(ePromotion, true);
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("UnitPromoted"))
+#else
 		if (pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(((int)getOwner()));
@@ -10266,7 +10322,11 @@ bool CvUnit::CanUpgradeRightNow(bool bOnlyTestVisible) const
 		}
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("CanHaveAnyUpgrade"))
+#else
 		if (pkScriptSystem)
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(((int)getOwner()));
@@ -10309,7 +10369,11 @@ UnitTypes CvUnit::GetUpgradeUnitType() const
 				eUpgradeUnitType = (UnitTypes) kCiv.getCivilizationUnits(iI);
 
 				ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+				if (pkScriptSystem && LuaSupport::HasGameEventListeners("CanHaveUpgrade"))
+#else
 				if (pkScriptSystem) 
+#endif
 				{
 					CvLuaArgsHandle args;
 					args->Push(((int)getOwner()));
@@ -10430,7 +10494,11 @@ CvUnit* CvUnit::DoUpgrade()
 		}
 
 		ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+		if (pkScriptSystem && LuaSupport::HasGameEventListeners("UnitUpgraded"))
+#else
 		if (pkScriptSystem) 
+#endif
 		{
 			CvLuaArgsHandle args;
 			args->Push(((int)getOwner()));
@@ -11253,6 +11321,28 @@ int CvUnit::GetBaseCombatStrengthConsideringDamage() const
 	return iStrength;
 }
 
+#ifdef AUI_UNIT_CACHED_SURROUNDINGS_MODIFIERS
+//	--------------------------------------------------------------------------------
+/// Refreshes the results of the neighborhood scans used by GetGenericMaxStrengthModifier() if the unit moved or anything on the map changed since they were taken
+void CvUnit::UpdateSurroundingsModifierCache() const
+{
+	CvPlot* pPlot = plot();
+	int iPlotIndex = pPlot ? pPlot->GetPlotIndex() : -1;
+	uint uiStamp = GC.getMap().GetPlotChangeStamp();
+	if (m_iSurroundingsCachePlot == iPlotIndex && m_uiSurroundingsCacheStamp == uiStamp)
+		return;
+
+	m_bSurroundingsNearGreatGeneral = IsNearGreatGeneral();
+	m_bSurroundingsStackedGreatGeneral = m_bSurroundingsNearGreatGeneral && IsStackedGreatGeneral();
+	m_iSurroundingsReverseGreatGeneralModifier = GetReverseGreatGeneralModifier();
+	m_iSurroundingsNearbyImprovementModifier = GetNearbyImprovementModifier();
+	m_bSurroundingsFriendlyCombatUnitAdjacent = pPlot && IsFriendlyUnitAdjacent(/*bCombatUnit*/ true);
+
+	m_iSurroundingsCachePlot = iPlotIndex;
+	m_uiSurroundingsCacheStamp = uiStamp;
+}
+
+#endif
 //	--------------------------------------------------------------------------------
 /// What are the generic strength modifiers for this Unit?
 int CvUnit::GetGenericMaxStrengthModifier(const CvUnit* pOtherUnit, const CvPlot* pBattlePlot, bool bIgnoreUnitAdjacency) const
@@ -11281,6 +11371,31 @@ int CvUnit::GetGenericMaxStrengthModifier(const CvUnit* pOtherUnit, const CvPlot
 	if(iTempModifier != 0)
 		iModifier += iTempModifier;
 
+#ifdef AUI_UNIT_CACHED_SURROUNDINGS_MODIFIERS
+	UpdateSurroundingsModifierCache();
+
+	// Great General nearby
+	if(m_bSurroundingsNearGreatGeneral && !IsIgnoreGreatGeneralBenefit())
+	{
+		iModifier += kPlayer.GetGreatGeneralCombatBonus();
+		iModifier += kPlayer.GetPlayerTraits()->GetGreatGeneralExtraBonus();
+
+		if(m_bSurroundingsStackedGreatGeneral)
+		{
+			iModifier += GetGreatGeneralCombatModifier();
+		}
+	}
+
+	// Reverse Great General nearby
+	iModifier += m_iSurroundingsReverseGreatGeneralModifier;
+
+	// Improvement with combat bonus (from trait) nearby
+	iModifier += m_iSurroundingsNearbyImprovementModifier;
+
+	// Adjacent Friendly military Unit?
+	if(m_bSurroundingsFriendlyCombatUnitAdjacent)
+		iModifier += GetAdjacentModifier();
+#else
 	// Great General nearby
 	if(IsNearGreatGeneral() && !IsIgnoreGreatGeneralBenefit())
 	{
@@ -11310,6 +11425,7 @@ int CvUnit::GetGenericMaxStrengthModifier(const CvUnit* pOtherUnit, const CvPlot
 	// Adjacent Friendly military Unit?
 	if(IsFriendlyUnitAdjacent(/*bCombatUnit*/ true))
 		iModifier += GetAdjacentModifier();
+#endif
 
 	// Our empire fights well in Golden Ages?
 	if(kPlayer.isGoldenAge())
@@ -14417,7 +14533,11 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 								{
 									bool bDisplaced = false;
 									ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+									if(pkScriptSystem && LuaSupport::HasGameEventListeners("CanDisplaceCivilian"))
+#else
 									if(pkScriptSystem)
+#endif
 									{
 										CvLuaArgsHandle args;
 										args->Push(pLoopUnit->getOwner());
@@ -15068,7 +15188,11 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("UnitSetXY"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(getOwner());
@@ -18966,7 +19090,11 @@ bool CvUnit::canAcquirePromotion(PromotionTypes ePromotion) const
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("CanHavePromotion"))
+#else
 	if (pkScriptSystem) 
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(((int)getOwner()));
@@ -19116,6 +19244,14 @@ void CvUnit::setHasPromotion(PromotionTypes eIndex, bool bNewValue)
 
 		m_Promotions.SetPromotion(eIndex, bNewValue);
 		iChange = ((isHasPromotion(eIndex)) ? 1 : -1);
+#ifdef AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+		// Promotions can change where this unit can go (terrain costs, amphibious, embarkation, extra moves), which danger footprints don't see
+		CvPlayerManager::InvalidateUnitDanger(getOwner(), GetID());
+#endif
+#ifdef AUI_UNIT_CACHED_SURROUNDINGS_MODIFIERS
+		// Promotions can make this unit a general or give it an aura, which changes cached combat modifiers of units around it
+		GC.getMap().NewPlotChangeStamp();
+#endif
 
 		// Promotions will set Invisibility once but not change it later
 		if(getInvisibleType() == NO_INVISIBLE && thisPromotion.GetInvisibleType() != NO_INVISIBLE)
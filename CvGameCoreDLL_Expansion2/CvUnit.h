@@ -1579,6 +1579,17 @@ protected:
 
 	mutable CvPathNodeArray m_kLastPath;
 	mutable uint m_uiLastPathCacheDest;
+#ifdef AUI_UNIT_CACHED_SURROUNDINGS_MODIFIERS
+	void UpdateSurroundingsModifierCache() const;
+
+	mutable uint m_uiSurroundingsCacheStamp;
+	mutable int m_iSurroundingsCachePlot;
+	mutable bool m_bSurroundingsNearGreatGeneral;
+	mutable bool m_bSurroundingsStackedGreatGeneral;
+	mutable bool m_bSurroundingsFriendlyCombatUnitAdjacent;
+	mutable int m_iSurroundingsReverseGreatGeneralModifier;
+	mutable int m_iSurroundingsNearbyImprovementModifier;
+#endif
 
 	bool canAdvance(const CvPlot& pPlot, int iThreshold) const;
 
@@ -2349,7 +2349,11 @@ void CvUnitCombat::GenerateNuclearCombatInfo(CvUnit& kAttacker, CvPlot& plot, Cv
 	}
 
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if (pkScriptSystem && LuaSupport::HasGameEventListeners("NuclearDetonation"))
+#else
 	if (pkScriptSystem) 
+#endif
 	{	
 		CvLuaArgsHandle args;
 
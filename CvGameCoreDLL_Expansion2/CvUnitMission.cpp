@@ -875,7 +875,11 @@ bool CvUnitMission::CanStartMission(UnitHandle hUnit, int iMission, int iData1,
 
 	// Prevented by scripting?
 	ICvEngineScriptSystem1* pkScriptSystem = gDLL->GetScriptSystem();
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(pkScriptSystem && LuaSupport::HasGameEventListeners("CanStartMission"))
+#else
 	if(pkScriptSystem)
+#endif
 	{
 		CvLuaArgsHandle args;
 		args->Push(hUnit->getOwner());
@@ -73,6 +73,11 @@ void CvLuaMap::RegisterMembers(lua_State* L)
 	Method(UpdateDeferredFog);
 	Method(ChangeAIMapHint);
 	Method(GetAIMapHint);
+#ifdef AUI_LUA_MAP_BULK_PLOT_DATA
+	Method(GetPlotDataInRect);
+	Method(GetPlotDataInRange);
+	Method(GetPlotDataForIndices);
+#endif
 }
 //------------------------------------------------------------------------------
 int CvLuaMap::lAreas(lua_State* L)
@@ -460,3 +465,286 @@ int CvLuaMap::lGetAIMapHint(lua_State* L)
 	lua_pushinteger(L, GC.getMap().GetAIMapHint());
 	return 1;
 }
+#ifdef AUI_LUA_MAP_BULK_PLOT_DATA
+//------------------------------------------------------------------------------
+enum PlotDataFields
+{
+	PLOT_DATA_OWNER,
+	PLOT_DATA_TERRAIN_TYPE,
+	PLOT_DATA_FEATURE_TYPE,
+	PLOT_DATA_IMPROVEMENT_TYPE,
+	PLOT_DATA_RESOURCE_TYPE,
+	PLOT_DATA_REVEALED_OWNER,
+	PLOT_DATA_REVEALED_IMPROVEMENT_TYPE,
+	PLOT_DATA_REVEALED,
+	PLOT_DATA_VISIBLE,
+	PLOT_DATA_YIELD,
+	NUM_PLOT_DATA_FIELDS
+};
+static const char* const s_aszPlotDataFieldNames[NUM_PLOT_DATA_FIELDS] =
+{
+	"Owner",
+	"TerrainType",
+	"FeatureType",
+	"ImprovementType",
+	"ResourceType",
+	"RevealedOwner",
+	"RevealedImprovementType",
+	"Revealed",
+	"Visible",
+	"Yield"
+};
+//------------------------------------------------------------------------------
+// Creates an array sized for iNumPlots, stores it in the table at iParent under szName and leaves it on the stack
+static int PushPlotDataColumn(lua_State* L, int iParent, const char* szName, int iNumPlots)
+{
+	lua_createtable(L, iNumPlots, 0);
+	lua_pushvalue(L, -1);
+	lua_setfield(L, iParent, szName);
+	return lua_gettop(L);
+}
+//------------------------------------------------------------------------------
+struct PlotDataRequest
+{
+	bool abWanted[NUM_PLOT_DATA_FIELDS];
+	TeamTypes eTeam;
+	bool bDebug;
+};
+//------------------------------------------------------------------------------
+// Fields are given as a table of names, followed by an optional team (defaults to the active team) and debug flag for the team-dependent ones.
+// Anything here may raise a Lua error, so it must run before the caller has built its plot vector.
+static void ReadPlotDataRequest(lua_State* L, int iFieldsArg, PlotDataRequest& kRequest)
+{
+	luaL_checktype(L, iFieldsArg, LUA_TTABLE);
+	kRequest.eTeam = lua_isnoneornil(L, iFieldsArg + 1) ? GC.getGame().getActiveTeam() : (TeamTypes)lua_tointeger(L, iFieldsArg + 1);
+	kRequest.bDebug = luaL_optbool(L, iFieldsArg + 2, false);
+
+	bool* abWanted = kRequest.abWanted;
+	for (int iI = 0; iI < NUM_PLOT_DATA_FIELDS; iI++)
+		abWanted[iI] = false;
+
+	const int iNumFields = (int)lua_objlen(L, iFieldsArg);
+	for (int iI = 1; iI <= iNumFields; iI++)
+	{
+		lua_rawgeti(L, iFieldsArg, iI);
+		const char* szField = lua_tostring(L, -1);
+		int iField = 0;
+		for (; iField < NUM_PLOT_DATA_FIELDS; iField++)
+		{
+			if (szField && strcmp(szField, s_aszPlotDataFieldNames[iField]) == 0)
+				break;
+		}
+		if (iField == NUM_PLOT_DATA_FIELDS)
+			luaL_error(L, "Unknown plot data field '%s'", szField ? szField : "nil");
+		abWanted[iField] = true;
+		lua_pop(L, 1);
+	}
+
+	luaL_checkstack(L, 5 + NUM_PLOT_DATA_FIELDS + NUM_YIELD_TYPES, "too many plot data fields");
+}
+//------------------------------------------------------------------------------
+// The result has one array per field, in the same order as PlotIndex, X and Y; Yield is a table of such arrays indexed by YieldTypes.
+static int PushPlotData(lua_State* L, const std::vector<CvPlot*>& apkPlots, const PlotDataRequest& kRequest)
+{
+	const bool* abWanted = kRequest.abWanted;
+	const TeamTypes eTeam = kRequest.eTeam;
+	const bool bDebug = kRequest.bDebug;
+	const int iNumPlots = (int)apkPlots.size();
+
+	lua_createtable(L, 0, 3 + NUM_PLOT_DATA_FIELDS);
+	const int iResult = lua_gettop(L);
+	const int iIndexColumn = PushPlotDataColumn(L, iResult, "PlotIndex", iNumPlots);
+	const int iXColumn = PushPlotDataColumn(L, iResult, "X", iNumPlots);
+	const int iYColumn = PushPlotDataColumn(L, iResult, "Y", iNumPlots);
+
+	int aiColumn[NUM_PLOT_DATA_FIELDS];
+	for (int iI = 0; iI < NUM_PLOT_DATA_FIELDS; iI++)
+	{
+		aiColumn[iI] = 0;
+		if (abWanted[iI] && iI != PLOT_DATA_YIELD)
+			aiColumn[iI] = PushPlotDataColumn(L, iResult, s_aszPlotDataFieldNames[iI], iNumPlots);
+	}
+
+	int aiYieldColumn[NUM_YIELD_TYPES];
+	if (abWanted[PLOT_DATA_YIELD])
+	{
+		lua_createtable(L, NUM_YIELD_TYPES, 0);
+		const int iYieldTable = lua_gettop(L);
+		lua_pushvalue(L, iYieldTable);
+		lua_setfield(L, iResult, s_aszPlotDataFieldNames[PLOT_DATA_YIELD]);
+		for (int iI = 0; iI < NUM_YIELD_TYPES; iI++)
+		{
+			lua_createtable(L, iNumPlots, 0);
+			lua_pushvalue(L, -1);
+			lua_rawseti(L, iYieldTable, iI);
+			aiYieldColumn[iI] = lua_gettop(L);
+		}
+	}
+
+	for (int iI = 0; iI < iNumPlots; iI++)
+	{
+		const CvPlot* pPlot = apkPlots[iI];
+		const int iRow = iI + 1;
+
+		lua_pushinteger(L, pPlot->GetPlotIndex());
+		lua_rawseti(L, iIndexColumn, iRow);
+		lua_pushinteger(L, pPlot->getX());
+		lua_rawseti(L, iXColumn, iRow);
+		lua_pushinteger(L, pPlot->getY());
+		lua_rawseti(L, iYColumn, iRow);
+
+		if (aiColumn[PLOT_DATA_OWNER])
+		{
+			lua_pushinteger(L, pPlot->getOwner());
+			lua_rawseti(L, aiColumn[PLOT_DATA_OWNER], iRow);
+		}
+		if (aiColumn[PLOT_DATA_TERRAIN_TYPE])
+		{
+			lua_pushinteger(L, pPlot->getTerrainType());
+			lua_rawseti(L, aiColumn[PLOT_DATA_TERRAIN_TYPE], iRow);
+		}
+		if (aiColumn[PLOT_DATA_FEATURE_TYPE])
+		{
+			lua_pushinteger(L, pPlot->getFeatureType());
+			lua_rawseti(L, aiColumn[PLOT_DATA_FEATURE_TYPE], iRow);
+		}
+		if (aiColumn[PLOT_DATA_IMPROVEMENT_TYPE])
+		{
+			lua_pushinteger(L, pPlot->getImprovementType());
+			lua_rawseti(L, aiColumn[PLOT_DATA_IMPROVEMENT_TYPE], iRow);
+		}
+		if (aiColumn[PLOT_DATA_RESOURCE_TYPE])
+		{
+			// Only resources eTeam can see, like Plot:GetResourceType(team)
+			lua_pushinteger(L, pPlot->getResourceType(eTeam));
+			lua_rawseti(L, aiColumn[PLOT_DATA_RESOURCE_TYPE], iRow);
+		}
+		if (aiColumn[PLOT_DATA_REVEALED_OWNER])
+		{
+			lua_pushinteger(L, pPlot->getRevealedOwner(eTeam, bDebug));
+			lua_rawseti(L, aiColumn[PLOT_DATA_REVEALED_OWNER], iRow);
+		}
+		if (aiColumn[PLOT_DATA_REVEALED_IMPROVEMENT_TYPE])
+		{
+			lua_pushinteger(L, pPlot->getRevealedImprovementType(eTeam, bDebug));
+			lua_rawseti(L, aiColumn[PLOT_DATA_REVEALED_IMPROVEMENT_TYPE], iRow);
+		}
+		if (aiColumn[PLOT_DATA_REVEALED])
+		{
+			lua_pushboolean(L, pPlot->isRevealed(eTeam, bDebug));
+			lua_rawseti(L, aiColumn[PLOT_DATA_REVEALED], iRow);
+		}
+		if (aiColumn[PLOT_DATA_VISIBLE])
+		{
+			lua_pushboolean(L, pPlot->isVisible(eTeam, bDebug));
+			lua_rawseti(L, aiColumn[PLOT_DATA_VISIBLE], iRow);
+		}
+		if (abWanted[PLOT_DATA_YIELD])
+		{
+			for (int iYield = 0; iYield < NUM_YIELD_TYPES; iYield++)
+			{
+				lua_pushinteger(L, pPlot->getYield((YieldTypes)iYield));
+				lua_rawseti(L, aiYieldColumn[iYield], iRow);
+			}
+		}
+	}
+
+	lua_settop(L, iResult);
+	return 1;
+}
+//------------------------------------------------------------------------------
+// table GetPlotDataInRect(int x, int y, int width, int height, table fields, [TeamTypes team], [bool bDebug])
+int CvLuaMap::lGetPlotDataInRect(lua_State* L)
+{
+	const CvMap& kMap = GC.getMap();
+	const int iX = lua_tointeger(L, 1);
+	const int iY = lua_tointeger(L, 2);
+	// Anything wider or taller than the map would only revisit wrapped plots
+	const int iWidth = MIN(lua_tointeger(L, 3), (int)kMap.getGridWidth());
+	const int iHeight = MIN(lua_tointeger(L, 4), (int)kMap.getGridHeight());
+
+	PlotDataRequest kRequest;
+	ReadPlotDataRequest(L, 5, kRequest);
+
+	std::vector<CvPlot*> apkPlots;
+	if (iWidth > 0 && iHeight > 0)
+		apkPlots.reserve(iWidth * iHeight);
+	// Rows then columns; coordinates past the map edge wrap or are skipped the same way Map.GetPlot() handles them
+	for (int iDY = 0; iDY < iHeight; iDY++)
+	{
+		for (int iDX = 0; iDX < iWidth; iDX++)
+		{
+			CvPlot* pPlot = kMap.plot(iX + iDX, iY + iDY);
+			if (pPlot)
+				apkPlots.push_back(pPlot);
+		}
+	}
+
+	return PushPlotData(L, apkPlots, kRequest);
+}
+//------------------------------------------------------------------------------
+// table GetPlotDataInRange(int x, int y, int range, table fields, [TeamTypes team], [bool bDebug])
+int CvLuaMap::lGetPlotDataInRange(lua_State* L)
+{
+	CvMap& kMap = GC.getMap();
+	const int iX = lua_tointeger(L, 1);
+	const int iY = lua_tointeger(L, 2);
+	// No plot is further away than this, so a larger range would only revisit wrapped plots
+	const int iRange = MIN(lua_tointeger(L, 3), kMap.maxPlotDistance());
+
+	PlotDataRequest kRequest;
+	ReadPlotDataRequest(L, 4, kRequest);
+
+	std::vector<CvPlot*> apkPlots;
+	if (iRange >= 0)
+		apkPlots.reserve(MIN(1 + 3 * iRange * (iRange + 1), (int)kMap.numPlots()));
+	// Once the hexagon is wider or taller than a wrapping map it reaches some plots from both sides
+	std::vector<bool> abAdded;
+	if ((kMap.isWrapX() && 2 * iRange + 1 > (int)kMap.getGridWidth()) || (kMap.isWrapY() && 2 * iRange + 1 > (int)kMap.getGridHeight()))
+		abAdded.resize(kMap.numPlots(), false);
+	for (int iDY = -iRange; iDY <= iRange; iDY++)
+	{
+		const int iMaxDX = iRange - MAX(0, iDY);
+		for (int iDX = -iRange - MIN(0, iDY); iDX <= iMaxDX; iDX++) // MIN() and MAX() stuff is to reduce loops (hexspace!)
+		{
+			CvPlot* pPlot = plotXY(iX, iY, iDX, iDY);
+			if (pPlot)
+			{
+				if (!abAdded.empty())
+				{
+					if (abAdded[pPlot->GetPlotIndex()])
+						continue;
+					abAdded[pPlot->GetPlotIndex()] = true;
+				}
+				apkPlots.push_back(pPlot);
+			}
+		}
+	}
+
+	return PushPlotData(L, apkPlots, kRequest);
+}
+//------------------------------------------------------------------------------
+// table GetPlotDataForIndices(table plotIndices, table fields, [TeamTypes team], [bool bDebug])
+int CvLuaMap::lGetPlotDataForIndices(lua_State* L)
+{
+	luaL_checktype(L, 1, LUA_TTABLE);
+	PlotDataRequest kRequest;
+	ReadPlotDataRequest(L, 2, kRequest);
+
+	const CvMap& kMap = GC.getMap();
+	const int iNumIndices = (int)lua_objlen(L, 1);
+	std::vector<CvPlot*> apkPlots;
+	apkPlots.reserve(iNumIndices);
+	for (int iI = 1; iI <= iNumIndices; iI++)
+	{
+		lua_rawgeti(L, 1, iI);
+		CvPlot* pPlot = kMap.plotByIndex(lua_tointeger(L, -1));
+		lua_pop(L, 1);
+		// Invalid indices are skipped, so check PlotIndex to match rows to what was asked for
+		if (pPlot)
+			apkPlots.push_back(pPlot);
+	}
+
+	return PushPlotData(L, apkPlots, kRequest);
+}
+#endif
@@ -128,6 +128,12 @@ protected:
 	static int lChangeAIMapHint(lua_State* L);
 	static int lGetAIMapHint(lua_State* L);
 
+#ifdef AUI_LUA_MAP_BULK_PLOT_DATA
+	static int lGetPlotDataInRect(lua_State* L);
+	static int lGetPlotDataInRange(lua_State* L);
+	static int lGetPlotDataForIndices(lua_State* L);
+#endif
+
 };
 
 #endif //CVLUAMAP_H
\ No newline at end of file
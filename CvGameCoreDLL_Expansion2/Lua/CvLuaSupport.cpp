@@ -21,7 +21,105 @@
 #include "CvLuaGame.h"
 #include "CvLuaPlayer.h"
 #include "CvLuaTeam.h"
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+#include <set>
+#include <string>
+#endif
 
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+//------------------------------------------------------------------------------
+// GameEvents listener registry
+//------------------------------------------------------------------------------
+namespace
+{
+struct GameEventNameLess
+{
+	bool operator()(const char* szLeft, const char* szRight) const
+	{
+		return strcmp(szLeft, szRight) < 0;
+	}
+};
+
+// Calls can come in from AI worker threads as well as the main thread, so every access goes through this lock
+struct GameEventRegistryLock
+{
+	GameEventRegistryLock()
+	{
+		InitializeCriticalSection(&m_kLock);
+	}
+	~GameEventRegistryLock()
+	{
+		DeleteCriticalSection(&m_kLock);
+	}
+	CRITICAL_SECTION m_kLock;
+};
+GameEventRegistryLock s_kGameEventRegistryLock;
+
+// Names are copied into the list so the set never points at caller memory
+std::list<std::string> s_GameEventNameStorage;
+std::set<const char*, GameEventNameLess> s_SilentGameEvents;
+
+struct GameEventListenerProbe
+{
+	const char* m_szName;
+	int m_iNumListeners;
+};
+
+// Run through lua_cpcall so a failing lookup can't unwind past our frames
+int ProbeGameEventListeners(lua_State* L)
+{
+	GameEventListenerProbe* pkProbe = static_cast<GameEventListenerProbe*>(lua_touserdata(L, 1));
+	lua_getglobal(L, "GameEvents");
+	if(lua_isnil(L, -1))
+	{
+		return 0;
+	}
+	lua_getfield(L, -1, pkProbe->m_szName);
+	if(lua_isnil(L, -1))
+	{
+		pkProbe->m_iNumListeners = 0;
+		return 0;
+	}
+	lua_getfield(L, -1, "Count");
+	if(lua_isfunction(L, -1))
+	{
+		lua_call(L, 0, 1);
+		if(lua_isnumber(L, -1))
+		{
+			pkProbe->m_iNumListeners = lua_tointeger(L, -1);
+		}
+	}
+	return 0;
+}
+
+// A false result from the script system also covers handlers that errored, so only go silent once Lua itself reports nobody is listening
+void OnGameEventCallFailed(ICvEngineScriptSystem1* pkScriptSystem, const char* szName)
+{
+	GameEventListenerProbe kProbe;
+	kProbe.m_szName = szName;
+	kProbe.m_iNumListeners = -1;
+	lua_State* L = pkScriptSystem->CreateLuaThread("GameEventListenerProbe");
+	if(L != NULL)
+	{
+		lua_cpcall(L, &ProbeGameEventListeners, &kProbe);
+		pkScriptSystem->FreeLuaThread(L);
+	}
+	if(kProbe.m_iNumListeners != 0)
+	{
+		return;
+	}
+
+	EnterCriticalSection(&s_kGameEventRegistryLock.m_kLock);
+	if(s_SilentGameEvents.find(szName) == s_SilentGameEvents.end())
+	{
+		s_GameEventNameStorage.push_back(std::string(szName));
+		s_SilentGameEvents.insert(s_GameEventNameStorage.back().c_str());
+	}
+	LeaveCriticalSection(&s_kGameEventRegistryLock.m_kLock);
+}
+}
+
+#endif
 //------------------------------------------------------------------------------
 // Utility methods
 //------------------------------------------------------------------------------
@@ -75,11 +173,24 @@ bool LuaSupport::CallHook(_In_ ICvEngineScriptSystem1* pkScriptSystem, _In_z_ co
 bool LuaSupport::CallHook(ICvEngineScriptSystem1* pkScriptSystem, const char* szName, ICvEngineScriptSystemArgs1* args, bool& value)
 #endif
 {
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!HasGameEventListeners(szName))
+	{
+		return false;
+	}
+
+#endif
 	// Must release our lock so that if the main thread has the Lua lock and is waiting for the Game Core lock, we don't freeze
 	bool bHadLock = gDLL->HasGameCoreLock();
 	if(bHadLock)
 		gDLL->ReleaseGameCoreLock();
 	bool bResult = pkScriptSystem->CallHook(szName, args, value);
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!bResult)
+	{
+		OnGameEventCallFailed(pkScriptSystem, szName);
+	}
+#endif
 	if(bHadLock)
 		gDLL->GetGameCoreLock();
 	return bResult;
@@ -92,11 +203,24 @@ bool LuaSupport::CallTestAll(_In_ ICvEngineScriptSystem1* pkScriptSystem, _In_z_
 bool LuaSupport::CallTestAll(ICvEngineScriptSystem1* pkScriptSystem, const char* szName, ICvEngineScriptSystemArgs1* args, bool& value)
 #endif
 {
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!HasGameEventListeners(szName))
+	{
+		return false;
+	}
+
+#endif
 	// Must release our lock so that if the main thread has the Lua lock and is waiting for the Game Core lock, we don't freeze
 	bool bHadLock = gDLL->HasGameCoreLock();
 	if(bHadLock)
 		gDLL->ReleaseGameCoreLock();
 	bool bResult = pkScriptSystem->CallTestAll(szName, args, value);
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!bResult)
+	{
+		OnGameEventCallFailed(pkScriptSystem, szName);
+	}
+#endif
 	if(bHadLock)
 		gDLL->GetGameCoreLock();
 	return bResult;
@@ -109,11 +233,24 @@ bool LuaSupport::CallTestAny(_In_ ICvEngineScriptSystem1* pkScriptSystem, _In_z_
 bool LuaSupport::CallTestAny(ICvEngineScriptSystem1* pkScriptSystem, const char* szName, ICvEngineScriptSystemArgs1* args, bool& value)
 #endif
 {
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!HasGameEventListeners(szName))
+	{
+		return false;
+	}
+
+#endif
 	// Must release our lock so that if the main thread has the Lua lock and is waiting for the Game Core lock, we don't freeze
 	bool bHadLock = gDLL->HasGameCoreLock();
 	if(bHadLock)
 		gDLL->ReleaseGameCoreLock();
 	bool bResult = pkScriptSystem->CallTestAny(szName, args, value);
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!bResult)
+	{
+		OnGameEventCallFailed(pkScriptSystem, szName);
+	}
+#endif
 	if(bHadLock)
 		gDLL->GetGameCoreLock();
 	return bResult;
@@ -122,11 +259,24 @@ bool LuaSupport::CallTestAny(ICvEngineScriptSystem1* pkScriptSystem, const char*
 //------------------------------------------------------------------------------
 bool LuaSupport::CallAccumulator(_In_ ICvEngineScriptSystem1* pkScriptSystem, _In_z_ const char* szName, _In_opt_ ICvEngineScriptSystemArgs1* args, int& value)
 {
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!HasGameEventListeners(szName))
+	{
+		return false;
+	}
+
+#endif
 	// Must release our lock so that if the main thread has the Lua lock and is waiting for the Game Core lock, we don't freeze
 	bool bHadLock = gDLL->HasGameCoreLock();
 	if(bHadLock)
 		gDLL->ReleaseGameCoreLock();
 	bool bResult = pkScriptSystem->CallAccumulator(szName, args, value);
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!bResult)
+	{
+		OnGameEventCallFailed(pkScriptSystem, szName);
+	}
+#endif
 	if(bHadLock)
 		gDLL->GetGameCoreLock();
 	return bResult;
@@ -135,14 +285,47 @@ bool LuaSupport::CallAccumulator(_In_ ICvEngineScriptSystem1* pkScriptSystem, _I
 //------------------------------------------------------------------------------
 bool LuaSupport::CallAccumulator(_In_ ICvEngineScriptSystem1* pkScriptSystem, _In_z_ const char* szName, _In_opt_ ICvEngineScriptSystemArgs1* args, float& value)
 {
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!HasGameEventListeners(szName))
+	{
+		return false;
+	}
+
+#endif
 	// Must release our lock so that if the main thread has the Lua lock and is waiting for the Game Core lock, we don't freeze
 	bool bHadLock = gDLL->HasGameCoreLock();
 	if(bHadLock)
 		gDLL->ReleaseGameCoreLock();
 	bool bResult = pkScriptSystem->CallAccumulator(szName, args, value);
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+	if(!bResult)
+	{
+		OnGameEventCallFailed(pkScriptSystem, szName);
+	}
+#endif
 	if(bHadLock)
 		gDLL->GetGameCoreLock();
 	return bResult;
 }
 
 //------------------------------------------------------------------------------
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+bool LuaSupport::HasGameEventListeners(_In_z_ const char* szName)
+{
+	EnterCriticalSection(&s_kGameEventRegistryLock.m_kLock);
+	bool bResult = s_SilentGameEvents.find(szName) == s_SilentGameEvents.end();
+	LeaveCriticalSection(&s_kGameEventRegistryLock.m_kLock);
+	return bResult;
+}
+
+//------------------------------------------------------------------------------
+void LuaSupport::RefreshGameEventListeners()
+{
+	EnterCriticalSection(&s_kGameEventRegistryLock.m_kLock);
+	s_SilentGameEvents.clear();
+	s_GameEventNameStorage.clear();
+	LeaveCriticalSection(&s_kGameEventRegistryLock.m_kLock);
+}
+
+//------------------------------------------------------------------------------
+#endif
@@ -47,6 +47,13 @@ bool CallTestAny(_In_ ICvEngineScriptSystem1* pkScriptSystem, _In_z_ const char*
 bool CallAccumulator(_In_ ICvEngineScriptSystem1* pkScriptSystem, _In_z_ const char* szName, _In_opt_ ICvEngineScriptSystemArgs1* args, int& value);
 bool CallAccumulator(_In_ ICvEngineScriptSystem1* pkScriptSystem, _In_z_ const char* szName, _In_opt_ ICvEngineScriptSystemArgs1* args, float& value);
 
+#ifdef AUI_GAME_EVENT_LISTENER_CACHE
+//! False if the event already reported that it has no listeners since the last refresh, so callers can skip building its arguments
+bool HasGameEventListeners(_In_z_ const char* szName);
+//! Forgets which events had no listeners, so the next call of each one goes through to Lua again
+void RefreshGameEventListeners();
+#endif
+
 }
 
 extern bool luaL_optbool(lua_State* L, int idx, bool bdefault);
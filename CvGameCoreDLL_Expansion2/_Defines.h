@@ -365,6 +365,10 @@
 #define AUI_ASTAR_GET_PENULTIMATE_NODE
 /// Fixes possible null pointer dereferences in A*
 #define AUI_ASTAR_FIX_POSSIBLE_NULL_POINTERS
+#ifdef AUI_ASTAR_FIX_POSSIBLE_NULL_POINTERS
+/// The open list is stored as an indexed binary heap instead of a sorted linked list, so insertions and cost decreases are O(log n) instead of O(n); ties are broken by insertion order, so generated paths are identical to the linked list version
+#define AUI_ASTAR_BINARY_HEAP_OPEN_LIST
+#endif
 /// Human-controlled missionaries and units will still want to avoid undesirable tiles a bit when planning paths, though not to the full extent that an AI-controlled unit would (parameter value is the extra "cost" weight added)
 #define AUI_ASTAR_HUMAN_UNITS_GET_DIMINISHED_AVOID_WEIGHT (1)
 /// Pointers to the plot representing each A* node are stored in the A* node in question
@@ -651,6 +655,62 @@
 #define DEL_RANGED_COUNTERATTACKS
 */
 
+// Turn processing performance
+/// Plots remember when something that affects pathing, ownership or visibility last changed on them, so caches built over a plot's neighborhood can tell whether they went stale
+#define AUI_PLOT_CHANGE_STAMPS
+#ifdef AUI_PLOT_CHANGE_STAMPS
+/// Danger plots keep each enemy unit's danger footprint and only recompute it when the unit or a plot around it changes, or when anything that can alter movement costs changes anywhere on the map; full rebuilds only happen when diplomatic states change
+#define AUI_DANGER_PLOTS_INCREMENTAL_UPDATE
+/// The tactical analysis map keeps a snapshot of each player's cells and only repopulates cells whose plot changed since that player's last turn
+#define AUI_TACTICAL_MAP_PERSISTENT_CELLS
+#if defined(AUI_ASTAR_TURN_LIMITER) && defined(AUI_ASTAR_MINOR_OPTIMIZATION)
+/// Results of TurnsToReachTarget() are memoized per unit, origin, target and unit state until a plot changes, danger is recomputed, diplomacy changes or the turn ends
+#define AUI_ASTAR_REACHABILITY_MEMO
+#endif
+/// AI players keep their found value map between turns and only re-evaluate plots near terrain, ownership, improvement, resource or city changes; the whole map is only re-evaluated when the player's site evaluation inputs (flavors, techs, resources, cities) change
+#define AUI_PLAYER_INCREMENTAL_FOUND_VALUES
+/// Units remember the results of the neighborhood scans behind their generic combat modifier (nearby generals, enemy combat auras, bonus improvements, adjacent friendly units) until any plot changes, a promotion changes or war is declared
+#define AUI_UNIT_CACHED_SURROUNDINGS_MODIFIERS
+#endif
+/// When the citizen manager looks for its best or worst plot or specialist, plots with identical yields and buildings with the same specialist type share a single value computation
+#define AUI_CITIZENS_SHARED_SCAN_VALUES
+/// Cities cache their base yield rates behind per-yield dirty flags set by the code that changes the underlying terrain, building, specialist, misc, religion and great work yields, and cache their trade route yields until a trade route is created, cleared or revalued
+#define AUI_CITY_CACHED_YIELD_RATES
+/// Players keep the per-city sums behind their city count, captured city, population, specialist and occupied population unhappiness between calls and only recount them after a city's population, specialists, occupation, puppet status or the relevant player modifiers change; annex/puppet/growth what-ifs swap out only the named city's share
+#define AUI_PLAYER_CACHED_CITY_UNHAPPINESS
+/// Plots are saved as a single checksummed section with a table of contents of map rows, so loading reads the whole section at once, validates it and decodes every row in place; a section that fails validation fails the load
+#define AUI_MAP_SECTIONED_PLOT_SAVE
+/// Opt-in: per-turn autosaves requested by the game core (network multiplayer, AI autoplay, post-turn) are only written every AUTOSAVE_TURN_INTERVAL turns (global define, 1 or missing = every turn, as before). Skipped turns are simply not saved, so an interval of N leaves fewer restore points and can lose up to N-1 turns after a crash or desync
+#define AUI_GAME_AUTOSAVE_TURN_INTERVAL
+/// Religious spread only looks at cities within the largest possible adjacency range (a range query on CvCityManager's grid of city buckets) and trade partners instead of every city in the game
+#define AUI_RELIGION_SPREAD_SPATIAL_INDEX
+/// CvCityManager buckets cities into blocks of map cells instead of keeping a distance-sorted list of every other city per city, and answers within-range and nearest-cities queries from the blocks
+#define AUI_CITY_MANAGER_GRID_INDEX
+/// CvPlot::changeAdjacentSight() walks a cached per-range template of offsets whose inward neighbours and line-of-sight tie-breaks are worked out once, instead of redoing the direction, distance and floating point geometry for every plot of every sight update
+#define AUI_PLOT_SIGHT_TEMPLATES
+/// CvBarbarians::DoCamps() collects the plots that could host a camp during its existing per-turn map scan and draws new camp sites from that list, instead of rolling random plot indices across the whole map until one happens to be valid
+#define AUI_BARBARIANS_CAMP_CANDIDATE_SET
+/// CvGame keeps the per-pair city distance figures behind player proximity (shared by both players of a pair, recomputed only when either one gains or loses a city) and each player's city defense strength that every diplomacy AI's threat estimates add to military might (recomputed only after one of that player's cities is gained, lost, damaged, healed or changes strength)
+#define AUI_GAME_SHARED_CIV_PAIR_METRICS
+/// Adds Map.GetPlotDataInRect(), Map.GetPlotDataInRange() and Map.GetPlotDataForIndices() to Lua, which return chosen plot fields for many plots as columns in one call, so UI overlays don't need a Map.GetPlot() and several getter calls per plot
+#define AUI_LUA_MAP_BULK_PLOT_DATA
+/// CvStepPathFinder labels the connected components of each player/enemy step passability map (rebuilt lazily after ownership, terrain, war, open borders or ocean passage change), so DoesPathExist() and GetStepDistanceBetweenPoints() can reject unreachable targets without a full A* search
+#define AUI_ASTAR_STEP_PATH_COMPONENTS
+/// The deal equalizers fold each newly added item into the running deal value instead of re-summing the whole deal through GetDealValue()
+#define AUI_DEAL_AI_INCREMENTAL_VALUATION
+/// While AI autoplay runs with AI perf logging enabled, every turn change appends the turn's wall-clock time, map size, living civs and a hash of the game state (independent of the turn slice, unlike the sync checksum) to AI-perf-autoplay.csv, so autoplay runs from the same save can be compared between builds
+#define AUI_GAME_AUTOPLAY_BENCHMARK_LOG
+/// Nested AI_PROFILE_SCOPE timings are aggregated per call path and player over each turn and written to AI-perf-stacks.txt as collapsed stacks for flame graphs (enabled with AI perf logging)
+#define AUI_HIERARCHICAL_TURN_PROFILER
+/// CvDatabaseUtility remembers the row count of each table it has looked up instead of running a new SELECT max(rowid) for every array it populates
+#define AUI_DATABASE_UTILITY_CACHED_MAX_ROWS
+/// GameEvents that Lua confirms have no listeners are remembered until the next game core update, so hot call sites (eg. CityCanConstruct) skip building their arguments
+#define AUI_GAME_EVENT_LISTENER_CACHE
+/// CvGameTrade keeps an index from plots to the trade connections passing through them, so per-plot trade queries don't scan every connection's path
+#define AUI_TRADE_PLOT_INDEX
+/// Per-plot passes of the AI's turn analysis that only read game state are split from the passes that write to shared state; the former only run on OpenMP worker threads if AUI_USE_OPENMP is also defined and the DLL is built with /openmp (otherwise both stay serial), the latter always stay serial and in plot order so results are deterministic
+#define AUI_PARALLEL_AI_ANALYSIS
+
 // GlobalDefines (GD) wrappers
 // INT
 #define GD_INT_DECL(name)       int m_i##name
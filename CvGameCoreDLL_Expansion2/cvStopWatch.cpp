@@ -99,3 +99,132 @@ void cvStopWatch::PerfLog(const char* szName, double dtSeconds)
 			LOGFILEMGR.GetLog(szLogFile, m_logFlags)->Msg(", %s, %f", szName, dtSeconds);
 	}
 }
+
+#ifdef AUI_HIERARCHICAL_TURN_PROFILER
+bool cvTurnProfiler::ms_bEnabled = false;
+bool cvTurnProfiler::ms_bInitialized = false;
+DWORD cvTurnProfiler::ms_dwCurrentNodeTls = TLS_OUT_OF_INDEXES;
+CRITICAL_SECTION cvTurnProfiler::ms_kLock;
+std::vector<cvTurnProfiler::Node> cvTurnProfiler::ms_aNodes;
+cvTurnProfiler::NodeLookup cvTurnProfiler::ms_kNodeLookup;
+//------------------------------------------------------------------------------
+void cvTurnProfiler::SetEnabled(bool bEnabled)
+{
+	if (bEnabled && !ms_bInitialized)
+	{
+		InitializeCriticalSection(&ms_kLock);
+		ms_dwCurrentNodeTls = TlsAlloc();
+		ms_bInitialized = (ms_dwCurrentNodeTls != TLS_OUT_OF_INDEXES);
+	}
+	ms_bEnabled = bEnabled && ms_bInitialized;
+}
+//------------------------------------------------------------------------------
+int cvTurnProfiler::EnterScope(const char* szName, int iPlayer)
+{
+	int iParentNode = (int)(size_t)TlsGetValue(ms_dwCurrentNodeTls) - 1;
+
+	EnterCriticalSection(&ms_kLock);
+	NodeKey kKey(iParentNode, std::make_pair(szName, iPlayer));
+	NodeLookup::const_iterator it = ms_kNodeLookup.find(kKey);
+	int iNode;
+	if (it != ms_kNodeLookup.end())
+	{
+		iNode = it->second;
+	}
+	else
+	{
+		Node kNode;
+		kNode.m_szName = szName;
+		kNode.m_iPlayer = iPlayer;
+		kNode.m_iParent = iParentNode;
+		kNode.m_llTicks = 0;
+		kNode.m_uiCalls = 0;
+		iNode = (int)ms_aNodes.size();
+		ms_aNodes.push_back(kNode);
+		ms_kNodeLookup[kKey] = iNode;
+	}
+	LeaveCriticalSection(&ms_kLock);
+
+	TlsSetValue(ms_dwCurrentNodeTls, (LPVOID)(size_t)(iNode + 1));
+	return iParentNode;
+}
+//------------------------------------------------------------------------------
+void cvTurnProfiler::ExitScope(int iParentNode, LONGLONG llTicks)
+{
+	int iNode = (int)(size_t)TlsGetValue(ms_dwCurrentNodeTls) - 1;
+	if (iNode >= 0)
+	{
+		EnterCriticalSection(&ms_kLock);
+		ms_aNodes[iNode].m_llTicks += llTicks;
+		ms_aNodes[iNode].m_uiCalls++;
+		LeaveCriticalSection(&ms_kLock);
+	}
+	TlsSetValue(ms_dwCurrentNodeTls, (LPVOID)(size_t)(iParentNode + 1));
+}
+//------------------------------------------------------------------------------
+void cvTurnProfiler::AppendPath(int iNode, CvString& strPath)
+{
+	const Node& kNode = ms_aNodes[iNode];
+	if (kNode.m_iParent >= 0)
+	{
+		AppendPath(kNode.m_iParent, strPath);
+	}
+	strPath += ";";
+	strPath += kNode.m_szName;
+	if (kNode.m_iPlayer >= 0 && kNode.m_iPlayer < MAX_PLAYERS)
+	{
+		strPath += " [";
+		strPath += GET_PLAYER((PlayerTypes)kNode.m_iPlayer).getCivilizationShortDescription();
+		strPath += "]";
+	}
+}
+//------------------------------------------------------------------------------
+void cvTurnProfiler::FlushTurn(int iTurn)
+{
+	if (!ms_bInitialized)
+		return;
+
+	EnterCriticalSection(&ms_kLock);
+	if (ms_bEnabled && !ms_aNodes.empty())
+	{
+		cvStopWatch::InitPerfTest();
+		LARGE_INTEGER ticksPerSecond;
+		QueryPerformanceFrequency(&ticksPerSecond);
+		const double dMicrosecondsPerTick = 1000000.0 / (double)ticksPerSecond.QuadPart;
+
+		// Children are always created after their parent, so one pass gives every node its children's total
+		std::vector<LONGLONG> allChildTicks(ms_aNodes.size(), 0);
+		for (uint ui = 0; ui < ms_aNodes.size(); ui++)
+		{
+			if (ms_aNodes[ui].m_iParent >= 0)
+			{
+				allChildTicks[ms_aNodes[ui].m_iParent] += ms_aNodes[ui].m_llTicks;
+			}
+		}
+
+		FILogFile* pLog = LOGFILEMGR.GetLog("AI-perf-stacks.txt", FILogFile::kDontTimeStamp);
+		for (uint ui = 0; ui < ms_aNodes.size(); ui++)
+		{
+			if (ms_aNodes[ui].m_uiCalls == 0)
+				continue;
+
+			// Flame graphs sum self time up the stack
+			LONGLONG llSelfTicks = ms_aNodes[ui].m_llTicks - allChildTicks[ui];
+			int iMicroseconds = (int)((llSelfTicks > 0 ? llSelfTicks : 0) * dMicrosecondsPerTick);
+
+			CvString strPath;
+			strPath.Format("Turn %03d", iTurn);
+			AppendPath((int)ui, strPath);
+			pLog->Msg("%s %d", strPath.c_str(), iMicroseconds);
+		}
+	}
+
+	// Nodes are kept so scopes that are still open stay valid, only the totals restart
+	for (uint ui = 0; ui < ms_aNodes.size(); ui++)
+	{
+		ms_aNodes[ui].m_llTicks = 0;
+		ms_aNodes[ui].m_uiCalls = 0;
+	}
+	LeaveCriticalSection(&ms_kLock);
+}
+#endif
@@ -46,6 +46,74 @@ private:
 	LARGE_INTEGER m_oldTimerVal;
 };
 
+#ifdef AUI_HIERARCHICAL_TURN_PROFILER
+//  Aggregates nested cvProfileScope timings by call path (and player) until the turn is flushed.
+//  Output is one collapsed stack per line ("Turn 012;CvGame::doTurn;Tactical AI [Rome] 1234", self time in microseconds),
+//  the format read by flame graph tools.
+class cvTurnProfiler
+{
+public:
+	static bool IsEnabled() { return ms_bEnabled; }
+	static void SetEnabled(bool bEnabled);
+
+	// Returns the scope that was current before entering, to be handed back to ExitScope()
+	static int EnterScope(const char* szName, int iPlayer);
+	static void ExitScope(int iParentNode, LONGLONG llTicks);
+
+	// Writes everything recorded since the last flush and clears the totals
+	static void FlushTurn(int iTurn);
+
+private:
+	struct Node
+	{
+		const char* m_szName;
+		int m_iPlayer;
+		int m_iParent;
+		LONGLONG m_llTicks;
+		uint m_uiCalls;
+	};
+	typedef std::pair< int, std::pair<const char*, int> > NodeKey;
+	typedef std::map<NodeKey, int> NodeLookup;
+
+	static void AppendPath(int iNode, CvString& strPath);
+
+	static bool ms_bEnabled;
+	static bool ms_bInitialized;
+	static DWORD ms_dwCurrentNodeTls; // each thread has its own scope stack, stored as its innermost node + 1
+	static CRITICAL_SECTION ms_kLock;
+	static std::vector<Node> ms_aNodes;
+	static NodeLookup ms_kNodeLookup;
+};
+
+class cvProfileScope
+{
+public:
+	cvProfileScope(const char* szName, int iPlayer = -1)
+	{
+		m_bActive = cvTurnProfiler::IsEnabled();
+		if (m_bActive)
+		{
+			m_iParentNode = cvTurnProfiler::EnterScope(szName, iPlayer);
+			QueryPerformanceCounter(&m_startTicks);
+		}
+	}
+	~cvProfileScope()
+	{
+		if (m_bActive)
+		{
+			LARGE_INTEGER endTicks;
+			QueryPerformanceCounter(&endTicks);
+			cvTurnProfiler::ExitScope(m_iParentNode, endTicks.QuadPart - m_startTicks.QuadPart);
+		}
+	}
+
+private:
+	bool m_bActive;
+	int m_iParentNode;
+	LARGE_INTEGER m_startTicks;
+};
+#endif
+
 #if !defined(FINAL_RELEASE)
 #define CVSTOPWATCH(x)	cvStopwatch(x)
 #define CVSTOPWATCH_STR(x)	std::ostringstream stopwatchstr; stopwatchstr << x; cvStopwatch(stopwatchstr.str())